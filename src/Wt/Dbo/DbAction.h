@@ -188,6 +188,11 @@ public:
 
   template<class C> void visitAuxIds(C& obj);
 
+  /*
+   * Binds all values of obj for an insert (as used by bulk inserts).
+   */
+  template<class C> void visitRow(C& obj);
+
   bool getsValue() const;
 
   int column() const { return column_; }
@@ -201,6 +206,9 @@ protected:
 
   enum { Dependencies, Self, Sets } pass_;
   bool needSetsPass_;
+  bool checkDependencies_;
+  bool unsavedDependencies_;
+  int *affectedRowCount_;
 
   void startDependencyPass();
   void startSelfPass();
@@ -215,8 +223,36 @@ class SaveDbAction : public SaveBaseAction
 public:
   SaveDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping);
 
+  /*
+   * Binds one row of a multi-row insert, starting at the given column.
+   */
+  SaveDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping,
+               SqlStatement *statement, int column);
+
   void visit(C& obj);
 
+  /*
+   * Without saving anything, returns whether one of the objects
+   * referenced by obj still needs to be saved or deleted.
+   */
+  bool hasUnsavedDependencies(C& obj);
+
+  /*
+   * The self pass of an insert, which binds obj to the statement, and
+   * the sets pass, which is needed after a multi-row insert if
+   * needSetsPass().
+   */
+  void visitInsertRow(C& obj);
+  void visitSets(C& obj);
+
+  bool needSetsPass() const { return needSetsPass_; }
+
+  /*
+   * Lets visit() execute an update as part of a batch: the affected
+   * row count is then stored instead of being checked.
+   */
+  void setAffectedRowCount(int *count) { affectedRowCount_ = count; }
+
   template<typename V> void actId(V& value, const std::string& name, int size);
   template<class D> void actId(ptr<D>& value, const std::string& name, int size,
                                int fkConstraints);
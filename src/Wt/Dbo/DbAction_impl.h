@@ -348,16 +348,31 @@ void SaveBaseAction::visitAuxIds(C& obj)
   persist<C>::apply(obj, *this);
 }
 
+template <class C>
+void SaveBaseAction::visitRow(C& obj)
+{
+  auxIdOnly_ = false;
+  isInsert_ = true;
+  pass_ = Self;
+
+  persist<C>::apply(obj, *this);
+}
+
 template<typename V>
-void SaveBaseAction::actId(WT_MAYBE_UNUSED V& value, const std::string&, int)
+void SaveBaseAction::actId(V& value, const std::string& name, int size)
 {
-  /* Only used from within visitAuxIds() */
+  /* Only used from within visitAuxIds() and visitRow() */
+  if (!auxIdOnly_)
+    field(*this, value, name, size);
 }
 
 template<class D>
-void SaveBaseAction::actId(WT_MAYBE_UNUSED ptr<D>& value, WT_MAYBE_UNUSED const std::string& name, WT_MAYBE_UNUSED int size, WT_MAYBE_UNUSED int fkConstraints)
+void SaveBaseAction::actId(ptr<D>& value, const std::string& name,
+                           WT_MAYBE_UNUSED int size, int fkConstraints)
 {
-  /* Only used from within visitAuxIds() */
+  /* Only used from within visitAuxIds() and visitRow() */
+  if (!auxIdOnly_)
+    actPtr(PtrRef<D>(value, name, fkConstraints));
 }
 
 template<class C>
@@ -367,8 +382,14 @@ void SaveBaseAction::actPtr(const PtrRef<C>& field)
   case Dependencies:
     {
       MetaDboBase *dbob = field.value().obj();
-      if (dbob)
-        dbob->flush();
+      if (dbob) {
+        if (checkDependencies_) {
+          if (dbob->isDirty()
+              || (dbob->isDeleted() && !dbob->deletedInTransaction()))
+            unsavedDependencies_ = true;
+        } else
+          dbob->flush();
+      }
     }
 
     break;
@@ -458,7 +479,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
             dbo1->bindId(statement, column);
             dbo2->bindId(statement, column);
 
-            statement->execute();
+            statement->executeDeferred();
           }
         }
 
@@ -485,7 +506,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
             dbo1->bindId(statement, column);
             dbo2->bindId(statement, column);
 
-            statement->execute();
+            statement->executeDeferred();
           }
         }
 
@@ -509,6 +530,47 @@ SaveDbAction<C>::SaveDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping)
     dbo_(dbo)
 { }
 
+template <class C>
+SaveDbAction<C>::SaveDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping,
+                              SqlStatement *statement, int column)
+  : SaveBaseAction(dbo, mapping, statement, column),
+    dbo_(dbo)
+{ }
+
+template<class C>
+bool SaveDbAction<C>::hasUnsavedDependencies(C& obj)
+{
+  checkDependencies_ = true;
+  unsavedDependencies_ = false;
+
+  startDependencyPass();
+  persist<C>::apply(obj, *this);
+
+  checkDependencies_ = false;
+
+  return unsavedDependencies_;
+}
+
+template<class C>
+void SaveDbAction<C>::visitInsertRow(C& obj)
+{
+  isInsert_ = true;
+  pass_ = Self;
+  needSetsPass_ = false;
+
+  if (mapping().versionFieldName)
+    statement_->bind(column_++, dbo_.version() + 1);
+
+  persist<C>::apply(obj, *this);
+}
+
+template<class C>
+void SaveDbAction<C>::visitSets(C& obj)
+{
+  startSetsPass();
+  persist<C>::apply(obj, *this);
+}
+
 template<class C>
 void SaveDbAction<C>::visit(C& obj)
 {
@@ -550,9 +612,9 @@ void SaveDbAction<C>::visit(C& obj)
 
     exec();
 
-    if (!isInsert_) {
+    if (!isInsert_ && mapping().versionFieldName && !affectedRowCount_) {
       int modifiedCount = statement_->affectedRowCount();
-      if (modifiedCount != 1 && mapping().versionFieldName) {
+      if (modifiedCount != 1) {
         throw StaleObjectException(dbo_.idStr(),
                                    dbo_.session()->template tableName<C>(),
                                    dbo_.version());
@@ -0,0 +1,193 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2024 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_DYNAMIC_SQL_CONNECTION_POOL_H_
+#define WT_DBO_DYNAMIC_SQL_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+
+#include <chrono>
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class DynamicSqlConnectionPool Wt/Dbo/DynamicSqlConnectionPool.h Wt/Dbo/DynamicSqlConnectionPool.h
+ *  \brief A connection pool that grows and shrinks with the load.
+ *
+ * Unlike FixedSqlConnectionPool, this pool opens connections (by
+ * cloning the initial connection) when they are needed, up to
+ * maxSize(), and closes connections that have been idle for longer
+ * than idleTimeout(), down to minSize().
+ *
+ * When all connections are in use, getConnection() waits for a
+ * connection to be returned. Waiting sessions are served in the order
+ * in which they asked for a connection.
+ *
+ * Idle connections can be checked periodically (see
+ * setHealthCheckInterval()) using SqlConnection::ping(): a connection
+ * that fails the check is closed and replaced by a new one, if a new
+ * connection can be opened.
+ *
+ * In a multi-threaded build, idle connections are closed and checked by
+ * a background thread. You can also call maintain() to do this.
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API DynamicSqlConnectionPool : public SqlConnectionPool
+{
+public:
+  //! The number of buckets in Statistics::waitTimeHistogram
+  static const int WaitTimeBuckets = 6;
+
+  /*! \brief Pool statistics.
+   *
+   * \sa statistics()
+   */
+  struct Statistics {
+    int size;                    //!< Number of open connections
+    int idle;                    //!< Number of idle connections
+    int waiting;                 //!< Number of waiting sessions
+
+    long long checkouts;         //!< Connections handed out
+    long long waits;             //!< Checkouts that had to wait
+    long long timeouts;          //!< Timeouts while waiting
+    long long opened;            //!< Connections opened
+    long long closed;            //!< Connections closed
+    long long healthCheckFailures; //!< Connections that failed a check
+
+    //! Longest time a session waited for a connection
+    std::chrono::steady_clock::duration maxWaitTime;
+
+    /*! \brief Number of checkouts by wait time.
+     *
+     * \sa waitTimeBucketLimit()
+     */
+    long long waitTimeHistogram[WaitTimeBuckets];
+  };
+
+  /*! \brief Creates a pool.
+   *
+   * The provided \p connection is kept to open connections (by
+   * cloning it), and is not itself used by sessions. The pool opens
+   * \p minSize connections, and will have at least one connection.
+   */
+  DynamicSqlConnectionPool(std::unique_ptr<SqlConnection> connection,
+                           int minSize, int maxSize);
+
+  virtual ~DynamicSqlConnectionPool();
+
+  /*! \brief Returns the minimum number of connections.
+   */
+  int minSize() const;
+
+  /*! \brief Returns the maximum number of connections.
+   */
+  int maxSize() const;
+
+  /*! \brief Set a timeout to get a connection.
+   *
+   * When the pool has no available connection, and cannot open a new
+   * one, it will wait the given duration.
+   *
+   * On timeout, handleTimeout() is called, which throws an exception
+   * by default.
+   *
+   * By default, there is no timeout.
+   */
+  void setTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Get the timeout to get a connection.
+   *
+   * \sa setTimeout()
+   */
+  std::chrono::steady_clock::duration timeout() const;
+
+  /*! \brief Sets the time after which an idle connection is closed.
+   *
+   * Connections are not closed when this would leave fewer than
+   * minSize() connections. A zero duration keeps idle connections open.
+   *
+   * The default is 10 minutes.
+   */
+  void setIdleTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Returns the time after which an idle connection is closed.
+   *
+   * \sa setIdleTimeout()
+   */
+  std::chrono::steady_clock::duration idleTimeout() const;
+
+  /*! \brief Sets the interval between checks of idle connections.
+   *
+   * A zero duration disables the checks. This is the default.
+   */
+  void setHealthCheckInterval(std::chrono::steady_clock::duration interval);
+
+  /*! \brief Returns the interval between checks of idle connections.
+   *
+   * \sa setHealthCheckInterval()
+   */
+  std::chrono::steady_clock::duration healthCheckInterval() const;
+
+  //! Get the total number of open connections
+  int size() const;
+
+  //! Get the total number of free connections available
+  int freeConnections() const;
+
+  /*! \brief Returns the statistics.
+   */
+  Statistics statistics() const;
+
+  /*! \brief Resets the counters of the statistics.
+   */
+  void resetStatistics();
+
+  /*! \brief Returns the upper limit of a wait time bucket.
+   *
+   * The limits are 1 ms, 10 ms, 100 ms, 1 s and 10 s. The last bucket
+   * has no upper limit.
+   */
+  static std::chrono::steady_clock::duration waitTimeBucketLimit(int bucket);
+
+  /*! \brief Closes idle connections, and checks idle connections.
+   *
+   * This closes connections which have been idle for longer than
+   * idleTimeout(), checks connections which have not been checked for
+   * healthCheckInterval(), and opens connections to have at least
+   * minSize() connections.
+   *
+   * In a multi-threaded build, this is done periodically by a
+   * background thread.
+   */
+  void maintain();
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+protected:
+  /*! \brief Handle a timeout that occured while getting a connection.
+   *
+   * The default implementation throws an Exception.
+   *
+   * If the function returns cleanly, the timeout is reset and another
+   * attempt is made to obtain a connection.
+   */
+  virtual void handleTimeout();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  std::unique_ptr<SqlConnection> openConnection();
+  void maintenanceLoop();
+};
+
+  }
+}
+
+#endif // WT_DBO_DYNAMIC_SQL_CONNECTION_POOL_H_
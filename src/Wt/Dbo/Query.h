@@ -7,6 +7,8 @@
 #ifndef WT_DBO_QUERY_H_
 #define WT_DBO_QUERY_H_
 
+#include <functional>
+#include <memory>
 #include <vector>
 #include <iostream>
 
@@ -17,6 +19,8 @@ namespace Wt {
   namespace Dbo {
 
     template <class C> class collection;
+    class SqlResultBatch;
+    class Transaction;
 
     namespace Impl {
 
@@ -286,6 +290,68 @@ protected:
   std::vector<Impl::ParameterBase *> parameters_;
 };
 
+/*! \class QueryStream Wt/Dbo/Query.h Wt/Dbo/Query.h
+ *  \brief A forward-only stream of query results.
+ *
+ * A stream is returned by Query::stream(), and reads the results of
+ * the query one by one, with next(). Unlike a collection, the results
+ * are not kept: the database backend fetches them in chunks (using a
+ * server-side cursor where needed), and database objects that are
+ * read are not added to the session. This allows a very large number
+ * of results to be processed, e.g. to export a table, with little
+ * memory.
+ *
+ * A database object (ptr) that is not yet loaded in the session is
+ * returned detached: it is not added to the session's identity map,
+ * and its changes will not be saved. Objects that it refers to (and
+ * its collections) are loaded lazily in the session, as usual. An
+ * object that was already loaded in the session is returned as is.
+ *
+ * The stream keeps the current transaction active until it is
+ * destroyed. Other queries may be run while reading the stream.
+ *
+ * \code
+ * Wt::Dbo::QueryStream<Wt::Dbo::ptr<Account> > accounts
+ *   = session.find<Account>().stream();
+ *
+ * Wt::Dbo::ptr<Account> account;
+ * while (accounts.next(account))
+ *   csv << account->name << ',' << account->balance << std::endl;
+ * \endcode
+ *
+ * \ingroup dbo
+ */
+template <class Result>
+class QueryStream
+{
+public:
+  /*! \brief Move constructor.
+   */
+  QueryStream(QueryStream&& other) = default;
+
+  /*! \brief Destructor.
+   *
+   * Closes the stream, if it was not yet read until the end.
+   */
+  ~QueryStream();
+
+  /*! \brief Reads the next result.
+   *
+   * Returns \c false when there are no more results.
+   */
+  bool next(Result& result);
+
+private:
+  QueryStream(Session *session);
+
+  Session *session_;
+  std::unique_ptr<Transaction> transaction_;
+  std::unique_ptr<SqlStatement> statement_;
+  bool done_;
+
+  template <class C, typename S> friend class Query;
+};
+
 /*! \class Query Wt/Dbo/Query.h Wt/Dbo/Query.h
  *  \brief A database query.
  *
@@ -404,11 +470,96 @@ public:
    * The query is not actually run until this collection is traversed
    * or its size is asked.
    *
+   * When all values of a \p Result are numbers or strings (e.g. a
+   * \c long \c long, a std::string, or a std::tuple<> of these), and
+   * the backend supports it, the rows are fetched in batches with
+   * SqlStatement::fetchBatch(). Other results, such as database objects
+   * (ptr) or dates, are read value by value with
+   * SqlStatement::getResult().
+   *
    * When using a DynamicBinding bind strategy, after a result has
    * been fetched, the query can no longer be used.
    */
   collection< Result > resultList() const;
 
+  /*! \brief Fetches the results in batches of rows.
+   *
+   * Runs the query, and calls \p function with the result rows, in
+   * batches of up to \p batchSize rows, which are stored by column
+   * (see SqlResultBatch). The query runs as a streaming statement (see
+   * stream()), so that a backend may fetch the rows from the database
+   * one batch at a time. Unlike resultList(), the rows are not loaded
+   * into \p Result values: this is useful to read (or aggregate) a large
+   * number of rows of plain values, for example in a report, without
+   * the cost of converting each value on its own.
+   *
+   * The columns of a batch are the columns of the select statement: a
+   * database object (ptr) result contributes its id, version and
+   * fields.
+   *
+   * \note This method is not available when using a DirectBinding
+   *       binding strategy.
+   */
+  void resultBatches(const std::function<void (const SqlResultBatch&)>&
+                     function, int batchSize = 1000) const;
+
+  /*! \brief Returns a stream of the results.
+   *
+   * Runs the query and returns a forward-only stream of its results,
+   * which are fetched from the database in chunks of about \p
+   * fetchSize rows. Unlike resultList(), the results are not kept in
+   * memory, and database objects are not added to the session.
+   *
+   * \sa QueryStream
+   *
+   * \note This method is not available when using a DirectBinding
+   *       binding strategy.
+   */
+  QueryStream<Result> stream(int fetchSize = 1000) const;
+
+  /*! \brief Loads a belongsTo() relation of the results in advance.
+   *
+   * For a query of database objects (\p Result is ptr<C>), the objects
+   * referenced by \p member are loaded when the results are fetched,
+   * using a single query for (up to) every 100 results, instead of a
+   * query for each object when it is first accessed, e.g.:
+   *
+   * \code
+   * Posts posts = session.find<Post>().fetch(&Post::author);
+   * for (dbo::ptr<Post> post : posts)
+   *   std::cerr << post->author->name; // does not query the database
+   * \endcode
+   *
+   * The results are then all read when resultList() is called.
+   *
+   * \sa Session::preload()
+   *
+   * \note This method is not available when using a DirectBinding
+   *       binding strategy.
+   */
+  template <class C, class D>
+  Query<Result, BindStrategy>& fetch(ptr<D> C::*member);
+
+  /*! \brief Loads a hasMany() relation of the results in advance.
+   *
+   * For a query of database objects (\p Result is ptr<C>), the
+   * contents of the \p member collection of each result are loaded
+   * when the results are fetched, using a single query for (up to)
+   * every 100 results, instead of a query for each collection when it
+   * is iterated, e.g.:
+   *
+   * \code
+   * Posts posts = session.find<Post>().fetch(&Post::comments);
+   * \endcode
+   *
+   * \sa Session::preload()
+   *
+   * \note This method is not available when using a DirectBinding
+   *       binding strategy.
+   */
+  template <class C, class D>
+  Query<Result, BindStrategy>& fetch(collection< ptr<D> > C::*member);
+
   /*! \brief Sets the count query.
    *
    * Sets the count query, which is the query that computes the number of
@@ -821,6 +972,13 @@ public:
   Query<Result, DynamicBinding> *countQuery() const { return altCountQuery_.get(); }
   Result resultValue() const;
   collection< Result > resultList() const;
+  void resultBatches(const std::function<void (const SqlResultBatch&)>&
+                     function, int batchSize = 1000) const;
+  QueryStream<Result> stream(int fetchSize = 1000) const;
+  template <class C, class D>
+  Query<Result, DynamicBinding>& fetch(ptr<D> C::*member);
+  template <class C, class D>
+  Query<Result, DynamicBinding>& fetch(collection< ptr<D> > C::*member);
   operator Result () const;
   operator collection< Result > () const;
 
@@ -832,6 +990,7 @@ private:
   Query(Session& session, const std::string& table, const std::string& where);
 
   std::unique_ptr<Query<Result, DynamicBinding>> altCountQuery_;
+  std::vector<std::function<void (const std::vector<Result>&)> > fetches_;
 
   SqlStatement *countStatement() const;
   SqlStatement *altCountQuery() const { return countQuery() ? countQuery()->countStatement() : nullptr; }
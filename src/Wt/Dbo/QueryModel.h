@@ -67,6 +67,10 @@ class QueryColumn;
  * you are only interested in rowCount(), not the actual data) then
  * you can avoid this behaviour by setting batchSize to 0.
  *
+ * A batch is read with Query::resultList(): when all values of a \p
+ * Result are numbers or strings, its rows are fetched with the
+ * columnar SqlStatement::fetchBatch().
+ *
  * \ingroup dbo modelview
  */
 template <class Result>
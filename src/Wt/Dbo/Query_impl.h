@@ -13,6 +13,7 @@
 #include <Wt/Dbo/Field.h>
 #include <Wt/Dbo/SqlStatement.h>
 #include <Wt/Dbo/DbAction.h>
+#include <Wt/Dbo/Transaction.h>
 
 #include <Wt/Dbo/Field_impl.h>
 
@@ -381,7 +382,8 @@ Query<Result, DynamicBinding>
 ::Query(const Query<Result, DynamicBinding>& other)
   : AbstractQuery(other),
     Impl::QueryBase<Result>(other),
-    altCountQuery_()
+    altCountQuery_(),
+    fetches_(other.fetches_)
 {
   if (other.altCountQuery_) {
     setCountQuery(*(other.countQuery()));
@@ -395,6 +397,7 @@ Query<Result, DynamicBinding>::operator=
 {
   Impl::QueryBase<Result>::operator=(other);
   AbstractQuery::operator=(other);
+  fetches_ = other.fetches_;
   if (other.altCountQuery_) {
     setCountQuery(*(other.countQuery()));
   } else {
@@ -571,7 +574,51 @@ collection<Result> Query<Result, DynamicBinding>::resultList() const
     bindParameters(this->session_, countStatement);
   }
 
-  return collection<Result>(this->session_, statement, countStatement);
+  collection<Result> result(this->session_, statement, countStatement);
+
+  if (fetches_.empty())
+    return result;
+
+  std::vector<Result> values;
+  for (const Result& value : result)
+    values.push_back(value);
+
+  for (unsigned i = 0; i < fetches_.size(); ++i)
+    fetches_[i](values);
+
+  return collection<Result>(this->session_, std::move(values));
+}
+
+template <class Result>
+template <class C, class D>
+Query<Result, DynamicBinding>&
+Query<Result, DynamicBinding>::fetch(ptr<D> C::*member)
+{
+  static_assert(std::is_same<Result, ptr<C> >::value,
+                "Query::fetch() requires a query for ptr<C>");
+
+  Session *session = this->session_;
+  fetches_.push_back([session, member](const std::vector<Result>& results) {
+      session->preload(results, member);
+    });
+
+  return *this;
+}
+
+template <class Result>
+template <class C, class D>
+Query<Result, DynamicBinding>&
+Query<Result, DynamicBinding>::fetch(collection< ptr<D> > C::*member)
+{
+  static_assert(std::is_same<Result, ptr<C> >::value,
+                "Query::fetch() requires a query for ptr<C>");
+
+  Session *session = this->session_;
+  fetches_.push_back([session, member](const std::vector<Result>& results) {
+      session->preload(results, member);
+    });
+
+  return *this;
 }
 
 template <class Result>
@@ -587,6 +634,105 @@ SqlStatement *Query<Result, DynamicBinding>::countStatement() const
   return countStatement;
 }
 
+template <class Result>
+void Query<Result, DynamicBinding>
+::resultBatches(const std::function<void (const SqlResultBatch&)>& function,
+                int batchSize) const
+{
+  if (!this->session_)
+    return;
+
+  this->session_->flush();
+
+  std::string sql = this->createQuerySelectSql(join_, where_, groupBy_,
+                                               having_, orderBy_,
+                                               limit_, offset_);
+
+  /*
+   * A streaming statement lets the backend fetch the rows from the
+   * database in chunks of a batch, rather than all at once.
+   */
+  std::unique_ptr<SqlStatement> statement
+    = this->session_->prepareStreamingStatement(sql, batchSize);
+
+  bindParameters(this->session_, statement.get());
+  statement->execute();
+
+  SqlResultBatch batch;
+  for (;;) {
+    int rows = statement->fetchBatch(batch, batchSize);
+    if (rows > 0)
+      function(batch);
+    if (rows == 0 || rows < batchSize)
+      break;
+  }
+}
+
+template <class Result>
+QueryStream<Result> Query<Result, DynamicBinding>::stream(int fetchSize) const
+{
+  QueryStream<Result> result(this->session_);
+
+  if (!this->session_)
+    return result;
+
+  this->session_->flush();
+
+  std::string sql = this->createQuerySelectSql(join_, where_, groupBy_,
+                                               having_, orderBy_,
+                                               limit_, offset_);
+
+  result.statement_ = this->session_->prepareStreamingStatement(sql, fetchSize);
+
+  bindParameters(this->session_, result.statement_.get());
+  result.statement_->execute();
+  result.done_ = false;
+
+  return result;
+}
+
+template <class Result>
+QueryStream<Result>::QueryStream(Session *session)
+  : session_(session),
+    done_(true)
+{
+  if (session_)
+    transaction_.reset(new Transaction(*session_));
+}
+
+template <class Result>
+QueryStream<Result>::~QueryStream()
+{
+  // the statement must go before the transaction
+  statement_.reset();
+}
+
+template <class Result>
+bool QueryStream<Result>::next(Result& result)
+{
+  if (done_)
+    return false;
+
+  if (!statement_->nextRow()) {
+    done_ = true;
+    statement_.reset();
+    return false;
+  }
+
+  int column = 0;
+
+  session_->loadDetached_ = true;
+  try {
+    result = query_result_traits<Result>::load(*session_, *statement_, column);
+  } catch (...) {
+    session_->loadDetached_ = false;
+    throw;
+  }
+  session_->loadDetached_ = false;
+
+  return true;
+}
+
 template <class Result>
 Query<Result, DynamicBinding>::operator Result () const
 {
@@ -0,0 +1,112 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2024 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_REPLICATED_SQL_CONNECTION_POOL_H_
+#define WT_DBO_REPLICATED_SQL_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+
+#include <chrono>
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class ReplicatedSqlConnectionPool Wt/Dbo/ReplicatedSqlConnectionPool.h Wt/Dbo/ReplicatedSqlConnectionPool.h
+ *  \brief A connection pool that uses read replicas for read-only transactions.
+ *
+ * This pool combines a pool of connections to the primary database
+ * server with pools of connections to read replicas of that database.
+ *
+ * Transactions use a connection to the primary server, except for
+ * read-only transactions (see TransactionMode::ReadOnly) which use a
+ * connection to a replica. Replicas are used in turn. A replica is
+ * skipped when it fails to provide a connection, or when it lags more
+ * than maxLag() behind the primary server (see
+ * SqlConnection::replicationLag()), until it is checked again after
+ * lagCheckInterval(). When no replica can be used, a read-only
+ * transaction uses the primary server.
+ *
+ * \code
+ * Wt::Dbo::FixedSqlConnectionPool primary(..., 10);
+ * Wt::Dbo::FixedSqlConnectionPool replica1(..., 10), replica2(..., 10);
+ *
+ * Wt::Dbo::ReplicatedSqlConnectionPool pool(primary);
+ * pool.addReplica(replica1);
+ * pool.addReplica(replica2);
+ * pool.setMaxLag(std::chrono::seconds(5));
+ *
+ * session.setConnectionPool(pool);
+ *
+ * {
+ *   Wt::Dbo::Transaction t(session, Wt::Dbo::TransactionMode::ReadOnly);
+ *   ... // reads from a replica
+ * }
+ * \endcode
+ *
+ * The pools are not owned by this pool, and must outlive it.
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API ReplicatedSqlConnectionPool : public SqlConnectionPool
+{
+public:
+  /*! \brief Creates a pool for the given primary pool.
+   */
+  explicit ReplicatedSqlConnectionPool(SqlConnectionPool& primary);
+
+  virtual ~ReplicatedSqlConnectionPool();
+
+  /*! \brief Returns the pool of the primary server.
+   */
+  SqlConnectionPool& primary() const;
+
+  /*! \brief Adds a pool of a read replica.
+   */
+  void addReplica(SqlConnectionPool& replica);
+
+  /*! \brief Sets the maximum replication lag.
+   *
+   * A replica which lags more is not used. A zero duration disables
+   * checking the lag. This is the default.
+   */
+  void setMaxLag(std::chrono::steady_clock::duration lag);
+
+  /*! \brief Returns the maximum replication lag.
+   *
+   * \sa setMaxLag()
+   */
+  std::chrono::steady_clock::duration maxLag() const;
+
+  /*! \brief Sets the interval between checks of a replica.
+   *
+   * The lag of a replica is checked when a connection is taken from
+   * it, at most once per interval. A replica that was skipped is tried
+   * again after this interval.
+   *
+   * The default is 1 second.
+   */
+  void setLagCheckInterval(std::chrono::steady_clock::duration interval);
+
+  /*! \brief Returns the interval between checks of a replica.
+   *
+   * \sa setLagCheckInterval()
+   */
+  std::chrono::steady_clock::duration lagCheckInterval() const;
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual std::unique_ptr<SqlConnection> getReadOnlyConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+  }
+}
+
+#endif // WT_DBO_REPLICATED_SQL_CONNECTION_POOL_H_
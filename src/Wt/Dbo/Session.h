@@ -11,6 +11,7 @@
 #include <set>
 #include <string>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <Wt/Dbo/ptr.h>
 #include <Wt/Dbo/Field.h>
@@ -47,6 +48,22 @@ namespace Wt {
                 int someFkConstraints);
       };
 
+      /*
+       * The type of the map of loaded objects of a class: a hash map,
+       * unless the id type has no std::hash (e.g. a composite id).
+       */
+      template <typename Id, typename V,
+                bool Hashed = std::is_arithmetic<Id>::value
+                              || std::is_same<Id, std::string>::value>
+      struct IdMap {
+        typedef std::map<Id, V> type;
+      };
+
+      template <typename Id, typename V>
+      struct IdMap<Id, V, true> {
+        typedef std::unordered_map<Id, V> type;
+      };
+
       struct WTDBO_API MappingInfo {
         bool initialized_;
         const char *tableName;
@@ -62,6 +79,20 @@ namespace Wt {
         std::vector<SetInfo> sets;
 
         std::vector<std::string> statements;
+        std::vector<std::size_t> statementIndexes;
+
+        /*
+         * The parts of the select statements (by index) that are also
+         * run for a batch of keys: the key column is empty when the
+         * key has more than one column.
+         */
+        struct BatchSelect {
+          std::string columns;
+          std::string from;
+          std::string key;
+        };
+
+        std::map<std::size_t, BatchSelect> batchSelects;
 
         MappingInfo();
         virtual ~MappingInfo();
@@ -74,8 +105,13 @@ namespace Wt {
         virtual MetaDboBase *load(Session& session, SqlStatement *statement,
                                   int& column);
         virtual void releaseMemory();
+        virtual void flushNew(Session& session,
+                              const std::vector<MetaDboBase *>& dbos);
+        virtual void flushUpdates(Session& session,
+                                  const std::vector<MetaDboBase *>& dbos);
 
         std::string primaryKeys() const;
+        int insertColumnCount() const;
       };
     }
 
@@ -94,6 +130,7 @@ enum class FlushMode {
 
 class Call;
 //class SqlConnection;
+class SharedCache;
 class SqlConnectionPool;
 class SqlStatement;
 template <typename Result, typename BindStrategy> class Query;
@@ -114,7 +151,8 @@ struct DynamicBinding;
  * You can provide the session with a dedicated database connection
  * using setConnection(), or with a connection pool (from which it
  * will take a connection while processing a transaction) using
- * setConnectionPool().
+ * setConnectionPool(). With a ReplicatedSqlConnectionPool, read-only
+ * transactions (see TransactionMode) use a read replica.
  *
  * A session will typically be a long-lived object in your
  * application.
@@ -160,6 +198,24 @@ public:
    */
   void setConnectionPool(SqlConnectionPool& pool);
 
+  /*! \brief Sets a shared cache.
+   *
+   * Objects of classes which enable dbo_traits::sharedCache() are then
+   * loaded from, and kept in, the cache, which is typically shared with
+   * other sessions. The cache must outlive the session.
+   *
+   * \sa SharedCache
+   */
+  void setSharedCache(SharedCache& cache);
+
+  /*! \brief Returns the shared cache.
+   *
+   * Returns \c nullptr if no cache was set.
+   *
+   * \sa setSharedCache()
+   */
+  SharedCache *sharedCache() const { return sharedCache_; }
+
   /*! \brief Maps a class to a database table.
    *
    * The class \p C is mapped to table with name \p tableName. You
@@ -222,6 +278,35 @@ public:
     return add(std::unique_ptr<T>(new T(std::forward<Args>(args)...)));
   }
 
+  /*! \brief Inserts objects in bulk.
+   *
+   * Inserts a row for each object of class \p C in the range [\p begin,
+   * \p end), using the values that are visited by its
+   * <tt>persist()</tt> method. This must be a forward iterator range.
+   *
+   * Unlike add(), the objects are not persisted in the session: they
+   * are only written to the database, and are not given an id or a
+   * version, nor are their collections saved. This is intended to load
+   * a large number of rows: the Postgres backend uses <tt>COPY</tt>,
+   * while other backends insert the rows using multi-row
+   * <tt>insert</tt> statements.
+   *
+   * The session is flushed first, so that objects that are referenced
+   * by the new rows are saved. This requires an active transaction.
+   *
+   * \sa SqlConnection::prepareBulkInsert()
+   */
+  template <class C, class Iterator>
+  void bulkInsert(Iterator begin, Iterator end);
+
+  /*! \brief Inserts objects in bulk.
+   *
+   * This is an overloaded method for convenience, which inserts the
+   * objects of a container (or other range).
+   */
+  template <class C, class Range>
+  void bulkInsert(const Range& objects);
+
   /*! \brief Loads a persisted object.
    *
    * This method returns a database object with the given object
@@ -261,6 +346,60 @@ public:
    */
   template <class C> ptr<C> loadLazy(const typename dbo_traits<C>::IdType& id);
 
+  /*! \brief Loads objects in batch.
+   *
+   * Loads those \p objects that are not yet loaded (e.g. which were
+   * obtained using loadLazy(), or by following a belongsTo() relation),
+   * using a single query for (up to) every 100 objects, instead of a
+   * query for each object when it is first accessed.
+   *
+   * Objects with an id of more than one column (or of a type without
+   * sql_value_traits) are not loaded in batch, but when accessed.
+   *
+   * Objects that are not found in the database are left unloaded: an
+   * ObjectNotFoundException is thrown when such an object is accessed.
+   *
+   * \sa Query::fetch()
+   */
+  template <class C> void preload(const std::vector< ptr<C> >& objects);
+
+  /*! \brief Loads the objects referenced by a belongsTo() relation in
+   *         batch.
+   *
+   * Loads the \p objects, and the objects referenced by their \p
+   * member, e.g.:
+   *
+   * \code
+   * session.preload(posts, &Post::author);
+   * \endcode
+   *
+   * \sa preload(const std::vector< ptr<C> >&)
+   */
+  template <class C, class D>
+  void preload(const std::vector< ptr<C> >& objects, ptr<D> C::*member);
+
+  /*! \brief Loads the contents of a hasMany() relation in batch.
+   *
+   * Loads the \p objects, and the contents of their \p member
+   * collection, using a single query for (up to) every 100 objects,
+   * e.g.:
+   *
+   * \code
+   * session.preload(posts, &Post::comments);
+   * \endcode
+   *
+   * Iterating the collection of one of the objects then does not
+   * query the database, until the session flushes changes or the
+   * transaction ends. The collection contents are then again read from
+   * the database.
+   *
+   * As with preload(const std::vector< ptr<C> >&), this is not done
+   * for objects with an id of more than one column.
+   */
+  template <class C, class D>
+  void preload(const std::vector< ptr<C> >& objects,
+               collection< ptr<D> > C::*member);
+
 #ifndef DOXYGEN_ONLY
   template <class C>
     Query< ptr<C> > find(const std::string& condition = std::string()) {
@@ -455,6 +594,9 @@ public:
    * flushed automatically before committing a transaction, or before
    * running a query (to be sure to take into account pending
    * modifications).
+   *
+   * In a read-only transaction, an Exception is thrown if there are
+   * modified objects.
    */
   void flush();
 
@@ -563,7 +705,8 @@ private:
   template <class C>
   struct Mapping : public Impl::MappingInfo
   {
-    typedef std::map<typename dbo_traits<C>::IdType, MetaDbo<C> *> Registry;
+    typedef typename Impl::IdMap<typename dbo_traits<C>::IdType,
+                                 MetaDbo<C> *>::type Registry;
     Registry registry_;
 
     virtual ~Mapping();
@@ -576,16 +719,23 @@ private:
     virtual MetaDbo<C> *load(Session& session, SqlStatement *statement,
                              int& column) override;
     virtual void releaseMemory() override;
+    virtual void flushNew(Session& session,
+                          const std::vector<MetaDboBase *>& dbos) override;
+    virtual void flushUpdates(Session& session,
+                              const std::vector<MetaDboBase *>& dbos) override;
   };
 
   typedef const std::type_info * const_typeinfo_ptr;
-  struct typecomp {
-    bool operator() (const const_typeinfo_ptr& lhs, const const_typeinfo_ptr& rhs) const { return lhs->before(*rhs) != 0; }
+  struct typehash {
+    std::size_t operator() (const const_typeinfo_ptr& t) const { return t->hash_code(); }
+  };
+  struct typeequal {
+    bool operator() (const const_typeinfo_ptr& lhs, const const_typeinfo_ptr& rhs) const { return *lhs == *rhs; }
   };
 
-  typedef std::map<const_typeinfo_ptr,
-                   Impl::MappingInfo *, typecomp> ClassRegistry;
-  typedef std::map<std::string, Impl::MappingInfo *> TableRegistry;
+  typedef std::unordered_map<const_typeinfo_ptr, Impl::MappingInfo *,
+                             typehash, typeequal> ClassRegistry;
+  typedef std::unordered_map<std::string, Impl::MappingInfo *> TableRegistry;
 
   ClassRegistry classRegistry_;
   TableRegistry tableRegistry_;
@@ -597,10 +747,15 @@ private:
   std::vector<MetaDboBase*> objectsToAdd_;
   std::unique_ptr<SqlConnection> connection_;
   SqlConnectionPool *connectionPool_;
+  SharedCache *sharedCache_;
   Transaction::Impl *transaction_;
   FlushMode flushMode_;
   bool mustDiscardChange_;
   bool allowNestedTransaction_;
+  bool loadDetached_;
+  unsigned long changeCount_;
+
+  static const std::size_t BatchLoadSize = 100;
 
   void initSchema() const;
   void resolveJoinIds(Impl::MappingInfo *mapping);
@@ -664,28 +819,58 @@ private:
   void discardChanges(MetaDboBase *obj);
   template <class C> void prune(MetaDbo<C> *obj);
 
-  template<class C> void implSave(MetaDbo<C>& dbo);
+  template<class C> void implSave(MetaDbo<C>& dbo,
+                                  int *affectedRowCount = nullptr);
+  template<class C> void implFlushNew(const std::vector<MetaDboBase *>& dbos);
+  template<class C>
+    void implFlushUpdates(const std::vector<MetaDboBase *>& dbos);
+  template<class C> void implInsert(const std::vector<MetaDbo<C> *>& dbos);
   template<class C> void implDelete(MetaDbo<C>& dbo);
   template<class C> void implTransactionDone(MetaDbo<C>& dbo, bool success);
   template<class C> void implLoad(MetaDbo<C>& dbo, SqlStatement *statement,
                                   int& column);
+  template<class C> void invalidateShared(MetaDbo<C>& dbo);
+  bool wroteShared(const char *tableName) const;
+  static std::size_t batchSize(std::size_t count);
+  SqlStatement *prepareBatchStatement(Impl::MappingInfo *mapping,
+                                      std::size_t statementIdx,
+                                      std::size_t size);
+  std::unique_ptr<SqlStatement> loadShared(MetaDboBase& dbo,
+                                           const char *tableName,
+                                           const std::string& id);
 
   static std::string statementId(const char *table, int statementIdx);
 
   template <class C> SqlStatement *getStatement(int statementIdx);
   SqlStatement *getStatement(const std::string& id);
   SqlStatement *getStatement(const char *tableName, int statementIdx);
+  SqlStatement *getStatement(Impl::MappingInfo *mapping, int statementIdx);
   const std::string& getStatementSql(const char *tableName, int statementIdx);
 
   SqlStatement *prepareStatement(const std::string& id,
                                  const std::string& sql);
   SqlStatement *getOrPrepareStatement(const std::string& sql);
 
+  /*
+   * How an insert statement deals with a surrogate id: it is returned
+   * by the statement, it is generated but not returned, or it is bound
+   * as the first value of each row.
+   */
+  enum class InsertId { Returned, NotReturned, Bound };
+
   template <class C> void prepareStatements();
+  std::string insertSql(Impl::MappingInfo *mapping, SqlConnection *conn,
+                        int rows, InsertId insertId = InsertId::Returned);
+  SqlStatement *getInsertStatement(Impl::MappingInfo *mapping, int rows,
+                                   InsertId insertId = InsertId::Returned);
+  std::unique_ptr<SqlStatement>
+    prepareBulkInsert(Impl::MappingInfo *mapping);
+  std::unique_ptr<SqlStatement>
+    prepareStreamingStatement(const std::string& sql, int fetchSize);
   template <class C> std::string manyToManyJoinId(const std::string& joinName,
                                                   const std::string& notId);
 
-  std::unique_ptr<SqlConnection> useConnection();
+  std::unique_ptr<SqlConnection> useConnection(bool readOnly = false);
   void returnConnection(std::unique_ptr<SqlConnection> connection);
   SqlConnection *connection(bool openTransaction);
 
@@ -695,6 +880,7 @@ private:
   template <class C> friend class collection;
   template <class C> friend class weak_ptr;
   template <class C, typename S> friend class Query;
+  template <class C> friend class QueryStream;
   friend class AbstractQuery;
   template <class C> friend class Impl::QueryBase;
   template <class C, typename T> friend struct Impl::LoadHelper;
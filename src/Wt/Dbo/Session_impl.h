@@ -7,8 +7,11 @@
 #ifndef WT_DBO_SESSION_IMPL_H_
 #define WT_DBO_SESSION_IMPL_H_
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
+#include <Wt/Dbo/SharedCache.h>
 #include <Wt/Dbo/SqlConnection.h>
 #include <Wt/Dbo/Query.h>
 
@@ -34,6 +37,37 @@ namespace Wt {
           return session->loadWithLongLongId<C>(statement, column);
         }
       };
+
+      /*
+       * Reads the key of a row of a batch select, which is only
+       * possible for a key type with sql_value_traits.
+       */
+      template <typename Id, typename Enable = void>
+      struct BatchKey
+      {
+        static const bool readable = false;
+
+        static bool read(WT_MAYBE_UNUSED Id& id,
+                         WT_MAYBE_UNUSED SqlStatement *statement,
+                         WT_MAYBE_UNUSED int column)
+        {
+          return false;
+        }
+      };
+
+      template <typename Id>
+      struct BatchKey<Id, decltype(void(sql_value_traits<Id>::read
+                                        (std::declval<Id&>(),
+                                         std::declval<SqlStatement *>(),
+                                         0, -1)))>
+      {
+        static const bool readable = true;
+
+        static bool read(Id& id, SqlStatement *statement, int column)
+        {
+          return sql_value_traits<Id>::read(id, statement, column, -1);
+        }
+      };
     }
 
 template <class C>
@@ -58,16 +92,8 @@ SqlStatement *Session::getStatement(int statementIdx)
   initSchema();
 
   ClassRegistry::iterator i = classRegistry_.find(&typeid(C));
-  Impl::MappingInfo *mapping = i->second;
-
-  std::string id = statementId(mapping->tableName, statementIdx);
 
-  SqlStatement *result = getStatement(id);
-
-  if (!result)
-    result = prepareStatement(id, mapping->statements[statementIdx]);
-
-  return result;
+  return getStatement(i->second, statementIdx);
 }
 
 template <class C>
@@ -141,7 +167,10 @@ MetaDbo<C> *Session::loadWithNaturalId(SqlStatement *statement, int& column)
     i = mapping->registry_.find(dbo->id());
 
   if (i == mapping->registry_.end()) {
-    mapping->registry_[dbo->id()] = dbo;
+    if (loadDetached_)
+      dbo->setSession(nullptr);
+    else
+      mapping->registry_[dbo->id()] = dbo;
     return dbo;
   } else {
     dbo->setSession(nullptr);
@@ -188,7 +217,10 @@ MetaDbo<C> *Session::loadWithLongLongId(SqlStatement *statement, int& column)
       dbo->setId(id);
       implLoad<MutC>(*dbo, statement, column);
 
-      mapping->registry_[id] = dbo;
+      if (loadDetached_)
+        dbo->setSession(nullptr);
+      else
+        mapping->registry_[id] = dbo;
 
       return dbo;
     } else {
@@ -261,6 +293,199 @@ ptr<C> Session::loadLazy(const typename dbo_traits<C>::IdType& id)
     return ptr<C>(i->second);
 }
 
+template <class C>
+void Session::preload(const std::vector< ptr<C> >& objects)
+{
+  typedef typename std::remove_const<C>::type MutC;
+
+  initSchema();
+
+  if (!transaction_)
+    throw Exception("Dbo preload(): no active transaction");
+
+  std::vector<MetaDbo<MutC> *> dbos;
+  std::set<MetaDbo<MutC> *> seen;
+  for (const ptr<C>& object : objects) {
+    MetaDbo<MutC> *dbo = object.obj();
+    if (dbo && dbo->session() == this && !dbo->isLoaded()
+        && !dbo->isNew() && !dbo->isDeleted() && seen.insert(dbo).second)
+      dbos.push_back(dbo);
+  }
+
+  if (dbos.empty())
+    return;
+
+  typedef typename dbo_traits<MutC>::IdType IdType;
+
+  if (!Impl::BatchKey<IdType>::readable)
+    return; // the objects are loaded when accessed
+
+  if (flushMode() == FlushMode::Auto)
+    flush();
+
+  Mapping<MutC> *mapping = getMapping<MutC>();
+
+  for (std::size_t b = 0; b < dbos.size(); b += BatchLoadSize) {
+    std::size_t count = std::min(dbos.size() - b,
+                                 static_cast<std::size_t>(BatchLoadSize));
+    std::size_t size = batchSize(count);
+
+    SqlStatement *statement
+      = prepareBatchStatement(mapping, SqlSelectById, size);
+    if (!statement)
+      return; // the id has more than one column
+
+    ScopedStatementUse use(statement);
+
+    statement->reset();
+
+    /* The last id is repeated to fill the batch */
+    int column = 0;
+    for (std::size_t i = 0; i < size; ++i)
+      dbos[b + std::min(i, count - 1)]->bindId(statement, column);
+
+    statement->execute();
+
+    while (statement->nextRow()) {
+      IdType id = dbo_traits<MutC>::invalidId();
+      if (!Impl::BatchKey<IdType>::read(id, statement, 0))
+        continue;
+
+      for (std::size_t i = b; i < b + count; ++i) {
+        MetaDbo<MutC> *dbo = dbos[i];
+        if (dbo->id() == id) {
+          if (!dbo->isLoaded()) {
+            column = 1;
+            implLoad<MutC>(*dbo, statement, column);
+          }
+          break;
+        }
+      }
+    }
+  }
+}
+
+template <class C, class D>
+void Session::preload(const std::vector< ptr<C> >& objects, ptr<D> C::*member)
+{
+  preload(objects);
+
+  std::vector< ptr<D> > related;
+  related.reserve(objects.size());
+
+  for (const ptr<C>& object : objects)
+    if (object && object.obj()->isLoaded())
+      related.push_back((*object).*member);
+
+  preload(related);
+}
+
+template <class C, class D>
+void Session::preload(const std::vector< ptr<C> >& objects,
+                      collection< ptr<D> > C::*member)
+{
+  typedef typename std::remove_const<C>::type MutC;
+  typedef typename dbo_traits<MutC>::IdType IdType;
+
+  preload(objects);
+
+  if (!Impl::BatchKey<IdType>::readable)
+    return; // the collections are loaded when traversed
+
+  /*
+   * The collections are all backed by the same relation query (which
+   * is set when an object is loaded), which is run for a batch of
+   * objects at once.
+   */
+  std::vector<collection< ptr<D> > *> collections;
+  std::vector<IdType> ids;
+  std::set<collection< ptr<D> > *> seen;
+  const std::string *sql = nullptr;
+
+  for (const ptr<C>& object : objects) {
+    if (!object || !object.obj()->isLoaded())
+      continue;
+
+    collection< ptr<D> >& c
+      = const_cast<collection< ptr<D> >&>((*object).*member);
+
+    if (c.type_ != collection< ptr<D> >::RelationCollection
+        || !c.data_.relation.sql || c.session_ != this)
+      continue;
+
+    if (!sql)
+      sql = c.data_.relation.sql;
+    else if (sql != c.data_.relation.sql)
+      continue;
+
+    if (seen.insert(&c).second) {
+      collections.push_back(&c);
+      ids.push_back(object.id());
+    }
+  }
+
+  if (collections.empty())
+    return;
+
+  if (flushMode() == FlushMode::Auto)
+    flush();
+
+  Mapping<MutC> *mapping = getMapping<MutC>();
+  std::size_t statementIdx = sql - mapping->statements.data();
+
+  for (std::size_t b = 0; b < collections.size(); b += BatchLoadSize) {
+    std::size_t count = std::min(collections.size() - b,
+                                 static_cast<std::size_t>(BatchLoadSize));
+    std::size_t size = batchSize(count);
+
+    std::vector<std::vector< ptr<D> > > values(count);
+
+    {
+      SqlStatement *statement
+        = prepareBatchStatement(mapping, statementIdx, size);
+      if (!statement)
+        return; // the foreign key has more than one column
+
+      ScopedStatementUse use(statement);
+
+      statement->reset();
+
+      /* The last id is repeated to fill the batch */
+      int column = 0;
+      for (std::size_t i = 0; i < size; ++i)
+        collections[b + std::min(i, count - 1)]
+          ->data_.relation.dbo->bindId(statement, column);
+
+      statement->execute();
+
+      std::size_t i = 0;
+      while (statement->nextRow()) {
+        IdType id = dbo_traits<MutC>::invalidId();
+        if (!Impl::BatchKey<IdType>::read(id, statement, 0))
+          continue;
+
+        /* The rows of a collection are usually together */
+        if (!(ids[b + i] == id)) {
+          for (i = 0; i < count; ++i)
+            if (ids[b + i] == id)
+              break;
+          if (i == count) {
+            i = 0;
+            continue;
+          }
+        }
+
+        column = 1;
+        values[i].push_back(query_result_traits< ptr<D> >
+                            ::load(*this, *statement, column));
+      }
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+      collections[b + i]->setFetched(std::move(values[i]), changeCount_);
+  }
+}
+
 template <class C, typename BindStrategy>
 Query< ptr<C>, BindStrategy > Session::find(const std::string& where)
 {
@@ -295,7 +520,7 @@ void Session::prune(MetaDbo<C> *obj)
 }
 
 template<class C>
-void Session::implSave(MetaDbo<C>& dbo)
+void Session::implSave(MetaDbo<C>& dbo, int *affectedRowCount)
 {
   if (!transaction_)
     throw Exception("Dbo save(): no active transaction");
@@ -306,9 +531,271 @@ void Session::implSave(MetaDbo<C>& dbo)
   Session::Mapping<C> *mapping = getMapping<C>();
 
   SaveDbAction<C> action(dbo, *mapping);
+  action.setAffectedRowCount(affectedRowCount);
   action.visit(*dbo.obj());
 
   mapping->registry_[dbo.id()] = &dbo;
+
+  invalidateShared(dbo);
+}
+
+template <class C, class Iterator>
+void Session::bulkInsert(Iterator begin, Iterator end)
+{
+  initSchema();
+
+  if (!transaction_)
+    throw Exception("Dbo bulkInsert(): no active transaction");
+
+  flush();
+  ++changeCount_;
+
+  Mapping<C> *mapping = getMapping<C>();
+
+  std::unique_ptr<SqlStatement> bulk = prepareBulkInsert(mapping);
+
+  if (bulk) {
+    for (; begin != end; ++begin) {
+      bulk->reset();
+
+      int column = 0;
+      if (mapping->versionFieldName)
+        bulk->bind(column++, 0);
+
+      SaveBaseAction action(this, bulk.get(), column);
+      action.visitRow(const_cast<C&>(static_cast<const C&>(*begin)));
+
+      bulk->execute();
+    }
+
+    transaction_->connection_->finishBulkInsert(bulk.get());
+  } else {
+    const int maxRows = std::max(1, transaction_->connection_->maxInsertRows
+                                 (mapping->insertColumnCount()));
+
+    while (begin != end) {
+      Iterator rowsEnd = begin;
+      int rows = 0;
+      for (; rowsEnd != end && rows < maxRows; ++rowsEnd)
+        ++rows;
+
+      SqlStatement *statement
+        = getInsertStatement(mapping, rows, InsertId::NotReturned);
+      ScopedStatementUse use(statement);
+      statement->reset();
+
+      int column = 0;
+      for (; begin != rowsEnd; ++begin) {
+        if (mapping->versionFieldName)
+          statement->bind(column++, 0);
+
+        SaveBaseAction action(this, statement, column);
+        action.visitRow(const_cast<C&>(static_cast<const C&>(*begin)));
+        column = action.column();
+      }
+
+      statement->executeDeferred();
+    }
+  }
+}
+
+template <class C, class Range>
+void Session::bulkInsert(const Range& objects)
+{
+  bulkInsert<C>(std::begin(objects), std::end(objects));
+}
+
+template <class C>
+void Session::implFlushNew(const std::vector<MetaDboBase *>& dbos)
+{
+  if (!transaction_)
+    throw Exception("Dbo save(): no active transaction");
+
+  Mapping<C> *mapping = getMapping<C>();
+  SqlConnection *conn = transaction_->connection_.get();
+
+  // a surrogate id is bound as an extra column (see implInsert())
+  std::size_t maxRows = conn->maxInsertRows
+    (mapping->insertColumnCount() + (mapping->surrogateIdFieldName ? 1 : 0));
+
+  std::vector<MetaDbo<C> *> rows;
+
+  for (unsigned i = 0; i < dbos.size(); ++i) {
+    MetaDbo<C> *dbo = dynamic_cast<MetaDbo<C> *>(dbos[i]);
+
+    // it may have been saved already, as a dependency of another object
+    if (!dbo->isDirty())
+      continue;
+
+    /*
+     * An object that depends on unsaved objects is saved on its own,
+     * after the objects before it, which they may depend on.
+     */
+    if (maxRows > 1) {
+      SaveDbAction<C> action(*dbo, *mapping);
+      if (!action.hasUnsavedDependencies(*dbo->obj())) {
+        rows.push_back(dbo);
+
+        if (rows.size() == maxRows) {
+          implInsert<C>(rows);
+          rows.clear();
+        }
+
+        continue;
+      }
+    }
+
+    implInsert<C>(rows);
+    rows.clear();
+
+    dbo->flush();
+  }
+
+  implInsert<C>(rows);
+}
+
+template <class C>
+void Session::implInsert(const std::vector<MetaDbo<C> *>& dbos)
+{
+  if (dbos.empty())
+    return;
+  else if (dbos.size() == 1) {
+    dbos[0]->flush();
+    return;
+  }
+
+  Mapping<C> *mapping = getMapping<C>();
+
+  /*
+   * The order of the ids that a multi-row insert returns is not
+   * defined: instead, the ids are reserved first and inserted with the
+   * rows. When that is not supported, the objects are inserted one by
+   * one.
+   */
+  std::vector<long long> ids;
+
+  if (mapping->surrogateIdFieldName) {
+    ids = transaction_->connection_->reserveAutoincrementIds
+      (mapping->tableName, mapping->surrogateIdFieldName,
+       static_cast<int>(dbos.size()));
+
+    if (ids.size() != dbos.size()) {
+      for (unsigned i = 0; i < dbos.size(); ++i)
+        dbos[i]->flush();
+      return;
+    }
+  }
+
+  SqlStatement *statement
+    = getInsertStatement(mapping, static_cast<int>(dbos.size()),
+                         ids.empty() ? InsertId::Returned : InsertId::Bound);
+
+  ScopedStatementUse use(statement);
+  statement->reset();
+
+  int column = 0;
+  bool needSetsPass = false;
+  unsigned bound = 0;
+
+  try {
+    for (; bound < dbos.size(); ++bound) {
+      MetaDbo<C>& dbo = *dbos[bound];
+
+      dbo.state_ &= ~MetaDboBase::NeedsSave;
+      dbo.state_ |= MetaDboBase::Saving;
+
+      transaction_->objects_.push_back(new ptr<C>(&dbo));
+
+      if (!ids.empty())
+        statement->bind(column++, ids[bound]);
+
+      SaveDbAction<C> action(dbo, *mapping, statement, column);
+      action.visitInsertRow(*dbo.obj());
+
+      column = action.column();
+      needSetsPass = action.needSetsPass();
+    }
+
+    statement->executeDeferred();
+  } catch (...) {
+    for (unsigned i = 0; i <= bound && i < dbos.size(); ++i)
+      dbos[i]->setTransactionState(MetaDboBase::SavedInTransaction);
+    throw;
+  }
+
+  for (unsigned i = 0; i < dbos.size(); ++i) {
+    MetaDbo<C>& dbo = *dbos[i];
+
+    if (!ids.empty())
+      dbo.setAutogeneratedId(ids[i]);
+
+    dbo.setTransactionState(MetaDboBase::SavedInTransaction);
+    mapping->registry_[dbo.id()] = &dbo;
+  }
+
+  if (needSetsPass)
+    for (unsigned i = 0; i < dbos.size(); ++i) {
+      SaveDbAction<C> action(*dbos[i], *mapping);
+      action.visitSets(*dbos[i]->obj());
+    }
+}
+
+template <class C>
+void Session::implFlushUpdates(const std::vector<MetaDboBase *>& dbos)
+{
+  if (!transaction_)
+    throw Exception("Dbo save(): no active transaction");
+
+  Mapping<C> *mapping = getMapping<C>();
+  SqlConnection *conn = transaction_->connection_.get();
+
+  /*
+   * The updates are executed as a batch, and the affected row counts
+   * of versioned objects are checked when the batch is finished.
+   */
+  std::vector<int> counts(dbos.size(), 1);
+  std::vector<MetaDbo<C> *> updated(dbos.size(), nullptr);
+
+  try {
+    for (unsigned i = 0; i < dbos.size(); ++i) {
+      MetaDbo<C> *dbo = dynamic_cast<MetaDbo<C> *>(dbos[i]);
+
+      // it may have been saved already, as a dependency of another object
+      if (!dbo->isDirty())
+        continue;
+
+      dbo->state_ &= ~MetaDboBase::NeedsSave;
+      dbo->state_ |= MetaDboBase::Saving;
+
+      try {
+        implSave(*dbo, mapping->versionFieldName ? &counts[i] : nullptr);
+        dbo->setTransactionState(MetaDboBase::SavedInTransaction);
+      } catch (...) {
+        dbo->setTransactionState(MetaDboBase::SavedInTransaction);
+        throw;
+      }
+
+      updated[i] = dbo;
+    }
+
+    conn->finishBatch();
+  } catch (...) {
+    /*
+     * Do not leave the backend with pointers to the counts; the first
+     * error is the one that is reported.
+     */
+    try {
+      conn->finishBatch();
+    } catch (...) {
+    }
+
+    throw;
+  }
+
+  for (unsigned i = 0; i < dbos.size(); ++i)
+    if (updated[i] && counts[i] != 1)
+      throw StaleObjectException(updated[i]->idStr(), tableName<C>(),
+                                 updated[i]->version());
 }
 
 template<class C>
@@ -339,7 +826,10 @@ void Session::implDelete(MetaDbo<C>& dbo)
     statement->bind(column++, version);
   }
 
-  statement->execute();
+  if (versioned)
+    statement->execute();
+  else
+    statement->executeDeferred();
 
   if (versioned) {
     int modifiedCount = statement->affectedRowCount();
@@ -347,6 +837,8 @@ void Session::implDelete(MetaDbo<C>& dbo)
       throw StaleObjectException(std::string()/*std::to_string(dbo.id())*/,
                                  this->tableName<C>(), version);
   }
+
+  invalidateShared(dbo);
 }
 
 template<class C>
@@ -362,6 +854,18 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   if (!transaction_)
     throw Exception("Dbo load(): no active transaction");
 
+  /*
+   * When loading by id, the row may be replayed from (or recorded
+   * for) the shared cache, unless the transaction wrote to the table:
+   * the row may then be one that is not committed.
+   */
+  std::unique_ptr<SqlStatement> shared;
+  if (!statement && sharedCache_ && dbo_traits<C>::sharedCache()
+      && !wroteShared(tableName<C>())) {
+    shared = loadShared(dbo, tableName<C>(), dbo.idStr());
+    statement = shared.get();
+  }
+
   LoadDbAction<C> action(dbo, *getMapping<C>(), statement, column);
 
   C *obj = new C();
@@ -372,6 +876,21 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
     delete obj;
     throw;
   }
+
+  if (shared)
+    sharedCache_->store(tableName<C>(), dbo.idStr(), dbo.version(),
+                        shared.get());
+}
+
+template <class C>
+void Session::invalidateShared(MetaDbo<C>& dbo)
+{
+  if (sharedCache_ && dbo_traits<C>::sharedCache()) {
+    sharedCache_->invalidate(tableName<C>(), dbo.idStr());
+
+    if (transaction_ && !wroteShared(tableName<C>()))
+      transaction_->sharedTablesWritten_.push_back(tableName<C>());
+  }
 }
 
 template <class C>
@@ -448,6 +967,20 @@ void Session::Mapping<C>::init(Session& session)
   }
 }
 
+template <class C>
+void Session::Mapping<C>::flushNew(Session& session,
+                                   const std::vector<MetaDboBase *>& dbos)
+{
+  session.template implFlushNew<C>(dbos);
+}
+
+template <class C>
+void Session::Mapping<C>::flushUpdates(Session& session,
+                                       const std::vector<MetaDboBase *>& dbos)
+{
+  session.template implFlushUpdates<C>(dbos);
+}
+
 template <class C>
 void Session::Mapping<C>::releaseMemory()
 {
@@ -0,0 +1,136 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2024 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_SHARED_CACHE_H_
+#define WT_DBO_SHARED_CACHE_H_
+
+#include <Wt/Dbo/WDboDllDefs.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Wt {
+  namespace Dbo {
+
+class Session;
+class SqlStatement;
+
+/*! \class SharedCache Wt/Dbo/SharedCache.h Wt/Dbo/SharedCache.h
+ *  \brief A cache of database objects, shared by sessions.
+ *
+ * Each Session keeps the objects that it loaded in its own identity
+ * map. When many sessions read the same (reference) data, e.g. a list
+ * of countries or a product catalog, each of them loads the same rows
+ * from the database. A shared cache, set on these sessions with
+ * Session::setSharedCache(), keeps the rows of such objects, and
+ * allows a session to load an object without a database query when
+ * another session loaded it before.
+ *
+ * Only classes that opt in with dbo_traits::sharedCache() are cached,
+ * and this is intended for data that is read often and changed
+ * rarely. The cache is used when an object is loaded by its id, e.g.
+ * with Session::load() or when dereferencing a ptr to an object which
+ * is not yet loaded; query results are always read from the database.
+ *
+ * An object is removed from the cache when a session that uses the
+ * cache saves or deletes it (both when it is flushed and when the
+ * transaction is committed). A row that was read while the object was
+ * being changed is not cached. Within a transaction that wrote objects
+ * of a table, the objects of that table are read from the database,
+ * and not cached; when such a transaction is rolled back, all rows of
+ * these tables are removed from the cache. Changes made to the database in other
+ * ways (e.g. with Session::execute(), or by another process) are not
+ * noticed: you may need to clear() the cache then.
+ *
+ * The cache is thread-safe, and holds up to maxSize() rows: the least
+ * recently used rows are evicted first.
+ *
+ * \code
+ * Wt::Dbo::SharedCache cache; // e.g. shared by all sessions
+ *
+ * Wt::Dbo::Session session;
+ * session.setConnectionPool(pool);
+ * session.setSharedCache(cache);
+ * \endcode
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API SharedCache
+{
+public:
+  /*! \brief Cache statistics.
+   *
+   * \sa statistics()
+   */
+  struct Statistics {
+    long long hits;          //!< Loads served from the cache
+    long long misses;        //!< Loads that went to the database
+    long long invalidations; //!< Rows removed because of a change
+    std::size_t size;        //!< Number of rows in the cache
+  };
+
+  /*! \brief Creates a cache.
+   */
+  explicit SharedCache(std::size_t maxSize = 10000);
+
+  /*! \brief Destructor.
+   *
+   * The cache must no longer be used by a session.
+   */
+  ~SharedCache();
+
+  SharedCache(const SharedCache&) = delete;
+  SharedCache& operator=(const SharedCache&) = delete;
+
+  /*! \brief Returns the maximum number of rows.
+   */
+  std::size_t maxSize() const { return maxSize_; }
+
+  /*! \brief Removes all rows from the cache.
+   */
+  void clear();
+
+  /*! \brief Removes the row of an object from the cache.
+   *
+   * The object is identified by its table name and its id (formatted
+   * as with <tt>std::ostream << id</tt>).
+   */
+  void invalidate(const std::string& tableName, const std::string& id);
+
+  /*! \brief Removes the rows of all objects of a table from the cache.
+   */
+  void invalidate(const std::string& tableName);
+
+  /*! \brief Returns the statistics.
+   */
+  Statistics statistics() const;
+
+  /*! \brief Resets the hit, miss and invalidation counts.
+   */
+  void resetStatistics();
+
+private:
+  struct Impl;
+  struct Row;
+  class RowStatement;
+
+  std::unique_ptr<Impl> impl_;
+  std::size_t maxSize_;
+
+  std::unique_ptr<SqlStatement> replay(const char *tableName,
+                                       const std::string& id);
+  std::unique_ptr<SqlStatement> record(SqlStatement *statement);
+  void store(const char *tableName, const std::string& id, int version,
+             SqlStatement *recorder);
+
+  friend class Session;
+};
+
+  }
+}
+
+#endif // WT_DBO_SHARED_CACHE_H_
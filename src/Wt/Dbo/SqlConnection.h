@@ -7,9 +7,12 @@
 #ifndef WT_DBO_SQL_CONNECTION_H_
 #define WT_DBO_SQL_CONNECTION_H_
 
+#include <chrono>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <Wt/Dbo/WDboDllDefs.h>
 
@@ -92,6 +95,26 @@ public:
    */
   virtual void executeSqlStateful(const std::string& sql);
 
+  /*! \brief Checks that the connection works.
+   *
+   * This is used by a connection pool to check idle connections (see
+   * DynamicSqlConnectionPool::setHealthCheckInterval()).
+   *
+   * The default implementation executes <tt>"select 1"</tt>, and
+   * returns \c false if this throws an exception.
+   */
+  virtual bool ping();
+
+  /*! \brief Returns the replication lag.
+   *
+   * For a connection to a read replica, this returns how far the
+   * replica lags behind the primary server. This is used by
+   * ReplicatedSqlConnectionPool to avoid replicas that lag too much.
+   *
+   * The default implementation returns zero.
+   */
+  virtual std::chrono::steady_clock::duration replicationLag();
+
   /*! \brief Starts a transaction
    *
    * This function starts a transaction.
@@ -125,6 +148,32 @@ public:
   virtual void saveStatement(const std::string& id,
                              std::unique_ptr<SqlStatement> statement);
 
+  /*! \brief Returns the index for a statement id.
+   *
+   * Statements which are used very often (such as those of mapped
+   * classes) can be cached with an index rather than a string id,
+   * which avoids hashing the id on each use. The index for an id is
+   * the same for all connections.
+   *
+   * \sa getStatement(std::size_t), saveStatement(std::size_t, std::unique_ptr<SqlStatement>)
+   */
+  static std::size_t statementIndex(const std::string& id);
+
+  /*! \brief Returns the statement with the given index.
+   *
+   * Returns \c nullptr if no such statement was already added.
+   *
+   * \sa statementIndex()
+   */
+  SqlStatement *getStatement(std::size_t index) const;
+
+  /*! \brief Saves a statement with the given index.
+   *
+   * Saves the statement for future reuse using getStatement(std::size_t)
+   */
+  void saveStatement(std::size_t index,
+                     std::unique_ptr<SqlStatement> statement);
+
   /*! \brief Prepares a statement.
    *
    * Returns the prepared statement.
@@ -206,6 +255,85 @@ public:
    */
   virtual std::string autoincrementInsertSuffix(const std::string& id) const = 0;
 
+  /*! \brief Returns the maximum number of rows for a multi-row insert.
+   *
+   * When flushing, new objects of the same class are inserted using a
+   * single <tt>insert ... values (...), (...), ...</tt> statement of at
+   * most this many rows, each of \p columnCount values. Objects with an
+   * autoincrement id are only inserted this way when their ids can be
+   * reserved first (see reserveAutoincrementIds()), since the order of
+   * the ids that a multi-row insert returns is not defined.
+   *
+   * The default implementation returns 1, which disables multi-row
+   * inserts.
+   */
+  virtual int maxInsertRows(int columnCount) const;
+
+  /*! \brief Reserves ids for an autoincrement column.
+   *
+   * Returns \p count ids for the autoincrement column \p id of
+   * \p table, which will not be generated for any other row. New
+   * objects are then inserted with these ids, using multi-row inserts
+   * (see maxInsertRows()).
+   *
+   * The default implementation returns an empty vector, and objects
+   * with an autoincrement id are then inserted one by one.
+   */
+  virtual std::vector<long long>
+    reserveAutoincrementIds(const std::string& table, const std::string& id,
+                            int count);
+
+  /*! \brief Prepares a statement for a bulk insert.
+   *
+   * Returns a statement that inserts a row in \p table each time it is
+   * executed, with values bound for the \p columns as for an
+   * <tt>insert</tt> statement. The table and column names are quoted.
+   *
+   * The rows may be buffered until finishBulkInsert() is called, and no
+   * other statement may be executed on the connection in the mean time.
+   *
+   * The default implementation returns \c nullptr, and then
+   * Session::bulkInsert() uses multi-row <tt>insert</tt> statements
+   * instead (see maxInsertRows()).
+   */
+  virtual std::unique_ptr<SqlStatement>
+    prepareBulkInsert(const std::string& table,
+                      const std::vector<std::string>& columns);
+
+  /*! \brief Finishes a bulk insert.
+   *
+   * Writes the remaining rows of a statement that was returned by
+   * prepareBulkInsert().
+   *
+   * The default implementation does nothing.
+   */
+  virtual void finishBulkInsert(SqlStatement *statement);
+
+  /*! \brief Finishes a batch of statements.
+   *
+   * Waits for the statements that were executed with
+   * SqlStatement::executeBatched(), and stores their affected row
+   * counts.
+   *
+   * The default implementation does nothing.
+   */
+  virtual void finishBatch();
+
+  /*! \brief Prepares a statement that streams its result.
+   *
+   * The returned statement is used for Query::stream(): it is not
+   * saved in the statement cache, and should not hold the complete
+   * result in memory, but fetch it in chunks of about \p fetchSize
+   * rows as nextRow() is called. Other statements may be executed on
+   * the connection while the result is being read.
+   *
+   * The default implementation calls prepareStatement(), which is
+   * suitable for a backend that already fetches its result one row at
+   * a time.
+   */
+  virtual std::unique_ptr<SqlStatement>
+    prepareStreamingStatement(const std::string& sql, int fetchSize);
+
   /*! \brief Execute code before dropping the tables.
    *
    * This method is called before calling Session::dropTables().
@@ -312,9 +440,11 @@ protected:
   const std::vector<std::string>& getStatefulSql() const { return statefulSql_; }
 
 private:
-  typedef std::multimap<std::string, std::unique_ptr<SqlStatement>> StatementMap;
+  typedef std::vector<std::unique_ptr<SqlStatement>> StatementList;
+  typedef std::unordered_map<std::string, StatementList> StatementMap;
 
   StatementMap statementCache_;
+  std::vector<StatementList> indexedStatementCache_;
   std::map<std::string, std::string> properties_;
   std::vector<std::string> statefulSql_;
 };
@@ -46,6 +46,18 @@ public:
    */
   virtual std::unique_ptr<SqlConnection> getConnection() = 0;
 
+  /*! \brief Uses a connection for a read-only transaction.
+   *
+   * This method is called by a Session when a read-only transaction is
+   * started (see TransactionMode::ReadOnly). A pool may then return a
+   * connection to a read replica.
+   *
+   * The default implementation calls getConnection().
+   *
+   * \sa ReplicatedSqlConnectionPool
+   */
+  virtual std::unique_ptr<SqlConnection> getReadOnlyConnection();
+
   /*! \brief Returns a connection to the pool.
    *
    * This returns a connection to the pool. This method is called by a
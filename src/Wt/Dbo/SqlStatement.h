@@ -7,6 +7,7 @@
 #ifndef WT_DBO_SQL_STATEMENT_H_
 #define WT_DBO_SQL_STATEMENT_H_
 
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <chrono>
@@ -16,6 +17,152 @@
 namespace Wt {
   namespace Dbo {
 
+/*! \class SqlResultBatch Wt/Dbo/SqlStatement.h Wt/Dbo/SqlStatement.h
+ *  \brief A batch of result rows, stored by column.
+ *
+ * A batch is filled by SqlStatement::fetchBatch() with a number of
+ * result rows at once. The values of each column are kept together,
+ * in a vector of integers, a vector of doubles, or in a single text
+ * buffer with the offsets of the values, so that a batch can be
+ * reused for the next rows without allocating memory for each value.
+ *
+ * The type of a column is decided by the backend, from the type of the
+ * column in the result. Integer columns include booleans (as 0 or 1),
+ * while all other types (dates, times, blobs, ...) are stored as text,
+ * in the textual representation of the database.
+ *
+ * \sa Query::resultBatches()
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API SqlResultBatch
+{
+public:
+  /*! \brief Enumeration for the type of a column.
+   */
+  enum class ColumnType {
+    Integer, //!< Values are stored as <tt>long long</tt>
+    Real,    //!< Values are stored as \c double
+    Text     //!< Values are stored as text
+  };
+
+  /*! \brief Creates an empty batch.
+   */
+  SqlResultBatch();
+
+  /*! \brief Returns the number of rows.
+   */
+  int rowCount() const { return rowCount_; }
+
+  /*! \brief Returns the number of columns.
+   */
+  int columnCount() const { return static_cast<int>(columns_.size()); }
+
+  /*! \brief Returns the type of a column.
+   */
+  ColumnType columnType(int column) const { return columns_[column].type; }
+
+  /*! \brief Returns whether a value is \c null.
+   */
+  bool isNull(int row, int column) const {
+    return columns_[column].nulls[row] != 0;
+  }
+
+  /*! \brief Returns the values of an integer column.
+   *
+   * The result has rowCount() values, with 0 for a \c null value.
+   */
+  const long long *integers(int column) const {
+    return columns_[column].integers.data();
+  }
+
+  /*! \brief Returns the values of a real column.
+   *
+   * The result has rowCount() values, with 0 for a \c null value.
+   */
+  const double *reals(int column) const {
+    return columns_[column].reals.data();
+  }
+
+  /*! \brief Returns a value of a text column.
+   *
+   * The value is not null-terminated: its length is returned in
+   * \p length. The result is only valid until the batch is cleared.
+   */
+  const char *text(int row, int column, std::size_t& length) const;
+
+  /*! \brief Returns a value as a string.
+   *
+   * The value of an integer or real column is converted to a string,
+   * and a \c null value is returned as an empty string.
+   */
+  std::string textValue(int row, int column) const;
+
+  /*! \brief Returns a value as an integer.
+   *
+   * The value of a real or text column is converted to an integer,
+   * and a \c null value is returned as 0.
+   */
+  long long integerValue(int row, int column) const;
+
+  /*! \brief Returns a value as a double.
+   *
+   * The value of an integer or text column is converted to a double,
+   * and a \c null value is returned as 0.
+   */
+  double realValue(int row, int column) const;
+
+  /*! \brief Removes all rows.
+   *
+   * The columns and the memory of the batch are kept.
+   */
+  void clear();
+
+  /*! \brief Sets the columns.
+   *
+   * This removes all rows and is used by a backend before adding the
+   * first row.
+   */
+  void setColumns(const std::vector<ColumnType>& types);
+
+  /*! \brief Adds a \c null value.
+   *
+   * Values are added column by column, for each row, by a backend.
+   */
+  void addNull(int column);
+
+  /*! \brief Adds a value to an integer column.
+   */
+  void addInteger(int column, long long value);
+
+  /*! \brief Adds a value to a real column.
+   */
+  void addReal(int column, double value);
+
+  /*! \brief Adds a value to a text column.
+   */
+  void addText(int column, const char *value, std::size_t length);
+
+  /*! \brief Ends a row.
+   *
+   * A value must have been added for each column.
+   */
+  void endRow() { ++rowCount_; }
+
+private:
+  struct Column {
+    ColumnType type;
+    std::vector<long long> integers;
+    std::vector<double> reals;
+    std::string text;
+    std::vector<std::size_t> offsets;
+    std::vector<unsigned char> nulls;
+  };
+
+  std::vector<Column> columns_;
+  int rowCount_;
+};
+
 /*! \brief Abstract base class for a prepared SQL statement.
  *
  * The statement may be used multiple times, but cannot be used
@@ -103,6 +250,36 @@ public:
    */
   virtual void execute() = 0;
 
+  /*! \brief Executes the statement, without waiting for its result.
+   *
+   * This may be used instead of execute() when the result of the
+   * statement (insertedId(), affectedRowCount() or result rows) is not
+   * needed. A backend may then queue the statement and send it to the
+   * database together with the statements that follow: an error is
+   * then reported by a later statement, or at the latest when the
+   * transaction is committed.
+   *
+   * The default implementation calls execute().
+   *
+   * \sa Postgres::setPipelineMode()
+   */
+  virtual void executeDeferred();
+
+  /*! \brief Executes the statement as part of a batch.
+   *
+   * This may be used instead of execute() when only the affected row
+   * count of the statement is needed, and only after a series of
+   * statements has been executed. Like executeDeferred(), a backend may
+   * queue the statement. The affected row count is stored in
+   * \p affectedRowCount at the latest when
+   * SqlConnection::finishBatch() returns, and \p affectedRowCount must
+   * remain valid until then.
+   *
+   * The default implementation calls execute() and stores
+   * affectedRowCount().
+   */
+  virtual void executeBatched(int *affectedRowCount);
+
   /*! \brief Returns the id if the statement was an SQL <tt>insert</tt>.
    */
   virtual long long insertedId() = 0;
@@ -186,6 +363,29 @@ public:
   virtual bool getResult(int column, std::vector<unsigned char> *value,
                          int size) = 0;
 
+  /*! \brief Fetches a batch of result rows.
+   *
+   * Fetches up to \p maxRows result rows (as with nextRow()) into the
+   * \p batch, replacing its contents, and returns the number of rows
+   * fetched. A result of 0 indicates that there are no more rows.
+   *
+   * A backend may reimplement this to convert the result values
+   * column by column, without going through getResult() for each
+   * value. The default implementation uses nextRow() and
+   * getResult(int, std::string *, int), and stores all columns as text.
+   */
+  virtual int fetchBatch(SqlResultBatch& batch, int maxRows);
+
+  /*! \brief Returns whether the backend reimplements fetchBatch().
+   *
+   * Query::resultList() only fetches its rows with fetchBatch() when
+   * this returns \c true, since the default implementation is not
+   * cheaper than getResult().
+   *
+   * The default implementation returns \c false.
+   */
+  virtual bool supportsFetchBatch() const;
+
   /*! \brief Returns the prepared SQL string.
    */
   virtual std::string sql() const = 0;
@@ -21,6 +21,7 @@ namespace Wt {
     }
 
 class Session;
+class SqlResultBatch;
 class SqlStatement;
 
 /*! \class sql_value_traits Wt/Dbo/SqlTraits.h Wt/Dbo/SqlTraits.h
@@ -388,6 +389,25 @@ struct query_result_traits
   static Result findById(Session& session, long long id);
 };
 
+    namespace Impl {
+
+/*
+ * Reads a query result from a row of a SqlResultBatch. This is only
+ * supported for results of which all values are numbers or strings:
+ * the standard integer and floating point types, std::string, and
+ * std::tuple<> of these (see ptr_tuple.h). Other results are read with
+ * query_result_traits::load().
+ */
+template <typename Result>
+struct batch_result_traits
+{
+  static const bool supported = false;
+
+  static void load(const SqlResultBatch& batch, int row, int& column,
+                   Result& result);
+};
+
+    }
   }
 }
 
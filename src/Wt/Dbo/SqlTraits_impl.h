@@ -97,6 +97,81 @@ Result query_result_traits<Result>::findById(WT_MAYBE_UNUSED Session& session, W
   return Result();
 }
 
+    namespace Impl {
+
+template <typename Result>
+void batch_result_traits<Result>
+::load(WT_MAYBE_UNUSED const SqlResultBatch& batch, WT_MAYBE_UNUSED int row,
+       WT_MAYBE_UNUSED int& column, WT_MAYBE_UNUSED Result& result)
+{ }
+
+template <typename T>
+struct batch_integer_traits
+{
+  static const bool supported = true;
+
+  static void load(const SqlResultBatch& batch, int row, int& column,
+                   T& result)
+  {
+    result = static_cast<T>(batch.integerValue(row, column++));
+  }
+};
+
+template <typename T>
+struct batch_real_traits
+{
+  static const bool supported = true;
+
+  static void load(const SqlResultBatch& batch, int row, int& column,
+                   T& result)
+  {
+    result = static_cast<T>(batch.realValue(row, column++));
+  }
+};
+
+template <>
+struct batch_result_traits<long long> : batch_integer_traits<long long> { };
+
+template <>
+struct batch_result_traits<long> : batch_integer_traits<long> { };
+
+template <>
+struct batch_result_traits<int> : batch_integer_traits<int> { };
+
+template <>
+struct batch_result_traits<short> : batch_integer_traits<short> { };
+
+template <>
+struct batch_result_traits<bool>
+{
+  static const bool supported = true;
+
+  static void load(const SqlResultBatch& batch, int row, int& column,
+                   bool& result)
+  {
+    result = batch.integerValue(row, column++) != 0;
+  }
+};
+
+template <>
+struct batch_result_traits<double> : batch_real_traits<double> { };
+
+template <>
+struct batch_result_traits<float> : batch_real_traits<float> { };
+
+template <>
+struct batch_result_traits<std::string>
+{
+  static const bool supported = true;
+
+  static void load(const SqlResultBatch& batch, int row, int& column,
+                   std::string& result)
+  {
+    result = batch.textValue(row, column++);
+  }
+};
+
+    }
   }
 }
 
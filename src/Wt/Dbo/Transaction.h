@@ -19,6 +19,15 @@ class SqlConnection;
 
 class ptr_base;
 
+/*! \brief Enumeration for the access mode of a transaction.
+ *
+ * \sa Transaction::Transaction(Session&, TransactionMode)
+ */
+enum class TransactionMode {
+  ReadWrite, //!< The transaction may change the database
+  ReadOnly   //!< The transaction only reads from the database
+};
+
 /*! \class Transaction Wt/Dbo/Transaction.h Wt/Dbo/Transaction.h
  *  \brief A database transaction.
  *
@@ -79,6 +88,23 @@ public:
    */
   explicit Transaction(Session& session);
 
+  /*! \brief Constructor with an access mode.
+   *
+   * Opens a transaction for the given \p session with the given
+   * \p mode.
+   *
+   * A read-only transaction uses a connection obtained with
+   * SqlConnectionPool::getReadOnlyConnection(), which may be a
+   * connection to a read replica (see ReplicatedSqlConnectionPool). Such
+   * a transaction does not flush changes to database objects: if there
+   * are pending changes when the session is flushed (see
+   * Session::flush()), an Exception is thrown.
+   *
+   * The mode only applies to a new transaction: a nested transaction
+   * joins the open transaction of the session, whatever its mode.
+   */
+  Transaction(Session& session, TransactionMode mode);
+
   /*! \brief Destructor.
    *
    * Under normal circumstances, the destructor will attempt to \link commit() commit\endlink the transaction
@@ -105,6 +131,12 @@ public:
    */
   bool isActive() const;
 
+  /*! \brief Returns whether the transaction is read-only.
+   *
+   * \sa Transaction(Session&, TransactionMode)
+   */
+  bool isReadOnly() const;
+
   /*! \brief Commits the transaction.
    *
    * If this is the last open transaction for the session, the session
@@ -142,9 +174,11 @@ private:
     bool active_;
     bool needsRollback_;
     bool open_;
+    bool readOnly_;
 
     int transactionCount_;
     std::vector<ptr_base *> objects_;
+    std::vector<const char *> sharedTablesWritten_;
 
     std::unique_ptr<SqlConnection> connection_;
 
@@ -152,7 +186,7 @@ private:
     void commit();
     void rollback();
 
-    Impl(Session& session_);
+    Impl(Session& session_, bool readOnly);
     ~Impl();
   };
 
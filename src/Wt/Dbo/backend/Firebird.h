@@ -103,6 +103,8 @@ namespace Wt {
 
         virtual std::unique_ptr<SqlStatement> prepareStatement(const std::string& sql) override;
 
+        virtual bool ping() override;
+
         /** @name Methods that return dialect information
          */
         //!@{
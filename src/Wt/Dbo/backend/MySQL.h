@@ -105,12 +105,20 @@ public:
 
   virtual std::unique_ptr<SqlStatement> prepareStatement(const std::string& sql) override;
 
+  /*! \brief Prepares a statement that streams its result.
+   *
+   * The result is read through a read-only server-side cursor.
+   */
+  virtual std::unique_ptr<SqlStatement>
+    prepareStreamingStatement(const std::string& sql, int fetchSize) override;
+
   /** @name Methods that return dialect information
    */
   //!@{
   virtual std::string autoincrementSql() const override;
   virtual std::string autoincrementType() const override;
   virtual std::string autoincrementInsertSuffix(const std::string& id) const override;
+  virtual int maxInsertRows(int columnCount) const override;
   virtual std::vector<std::string>
     autoincrementCreateSequenceSql(const std::string &table,
                                    const std::string &id) const override;
@@ -127,14 +127,80 @@ public:
    */
   void setMaximumLifetime(std::chrono::seconds seconds);
 
+  /*! \brief Enables pipeline mode.
+   *
+   * In pipeline mode, a statement of which the result is not needed
+   * (see SqlStatement::executeDeferred()) is queued instead of waiting
+   * for its result. This is the case for most inserts, updates and
+   * deletes while flushing a session. The queued statements are
+   * synchronized with the server when a result is needed, or when the
+   * transaction is committed, saving a network round trip for each of
+   * them.
+   *
+   * An error in a queued statement is reported by a later statement,
+   * or by the commit.
+   *
+   * Pipeline mode requires libpq 14 or later, and is ignored otherwise.
+   *
+   * The default value is \c false.
+   */
+  void setPipelineMode(bool enabled);
+
+  /*! \brief Returns whether pipeline mode is enabled.
+   *
+   * \sa setPipelineMode()
+   */
+  bool pipelineMode() const { return pipelineMode_; }
+
   virtual void executeSql(const std::string &sql) override;
 
+  /*! \brief Returns the replication lag.
+   *
+   * For a standby server, this is the time since the last replayed
+   * transaction, or zero when all received changes have been replayed.
+   */
+  virtual std::chrono::steady_clock::duration replicationLag() override;
+
   virtual void startTransaction() override;
   virtual void commitTransaction() override;
   virtual void rollbackTransaction() override;
 
   virtual std::unique_ptr<SqlStatement> prepareStatement(const std::string& sql) override;
 
+  /*! \brief Prepares a statement for a bulk insert.
+   *
+   * The rows are written with a <tt>COPY ... FROM STDIN</tt> statement
+   * (in text format).
+   */
+  virtual std::unique_ptr<SqlStatement>
+    prepareBulkInsert(const std::string& table,
+                      const std::vector<std::string>& columns) override;
+  virtual void finishBulkInsert(SqlStatement *statement) override;
+
+  /*! \brief Reserves ids for an autoincrement column.
+   *
+   * The ids are taken from the sequence of the column, using
+   * <tt>nextval()</tt>.
+   */
+  virtual std::vector<long long>
+    reserveAutoincrementIds(const std::string& table, const std::string& id,
+                            int count) override;
+
+  /*! \brief Finishes a batch of statements.
+   *
+   * In pipeline mode, the statements of a batch are queued, and their
+   * affected row counts are read when the pipeline is synchronized.
+   */
+  virtual void finishBatch() override;
+
+  /*! \brief Prepares a statement that streams its result.
+   *
+   * The result is read through a server-side cursor (<tt>DECLARE
+   * ... CURSOR</tt>), fetching \p fetchSize rows at a time.
+   */
+  virtual std::unique_ptr<SqlStatement>
+    prepareStreamingStatement(const std::string& sql, int fetchSize) override;
+
   /** @name Methods that return dialect information
    */
   //!@{
@@ -147,6 +213,7 @@ public:
                                  const std::string &id) const override;
   virtual std::string autoincrementType() const override;
   virtual std::string autoincrementInsertSuffix(const std::string& id) const override;
+  virtual int maxInsertRows(int columnCount) const override;
   virtual const char *dateTimeType(SqlDateTimeType type) const override;
   virtual const char *blobType() const override;
   virtual bool supportAlterTable() const override;
@@ -156,14 +223,21 @@ public:
 
   void checkConnection(std::chrono::seconds margin);
 
+  void enterPipeline();
+  void pipelineQueued(int *affectedRowCount = nullptr);
+  void syncPipeline();
+
 private:
   std::string connInfo_;
   PGconn *conn_;
   std::chrono::microseconds timeout_;
   std::chrono::seconds maximumLifetime_;
   std::chrono::steady_clock::time_point connectTime_;
+  bool pipelineMode_;
+  std::vector<int *> pipelined_;
 
   void exec(const std::string& sql, bool showQuery);
+  void waitForResult();
 };
 
     }
@@ -116,6 +116,15 @@ public:
 
   virtual std::unique_ptr<SqlStatement> prepareStatement(const std::string& sql) override;
 
+  /*! \brief Reserves ids for an autoincrement column.
+   *
+   * The ids are reserved by moving the last used id of the table in
+   * <tt>sqlite_sequence</tt> ahead.
+   */
+  virtual std::vector<long long>
+    reserveAutoincrementIds(const std::string& table, const std::string& id,
+                            int count) override;
+
   /** @name Methods that return dialect information
    */
   //@{
@@ -128,6 +137,7 @@ public:
                                  const std::string &id) const override;
   virtual std::string autoincrementType() const override;
   virtual std::string autoincrementInsertSuffix(const std::string& id) const override;
+  virtual int maxInsertRows(int columnCount) const override;
   virtual const char *dateTimeType(SqlDateTimeType type) const override;
   virtual const char *blobType() const override;
   virtual bool supportDeferrableFKConstraint() const override;
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <memory>
 #include <set>
 
 #include <Wt/Dbo/ptr.h>
@@ -19,6 +20,7 @@ namespace Wt {
     struct DirectBinding;
     struct DynamicBinding;
     template <class Result, typename BindStrategy> class Query;
+    class SqlResultBatch;
     class SqlStatement;
 
   /*! \class collection Wt/Dbo/collection.h Wt/Dbo/collection.h
@@ -178,6 +180,11 @@ namespace Wt {
       struct shared_impl {
         const collection<C>& collection_;
         SqlStatement *statement_;
+        const std::vector<C> *fetched_;
+        std::size_t posFetched_;
+        std::unique_ptr<SqlResultBatch> batch_;
+        int batchRow_;
+        bool batchEnded_;
         value_type current_;
         int useCount_;
         bool queryEnded_;
@@ -188,6 +195,7 @@ namespace Wt {
         ~shared_impl();
 
         void fetchNextRow();
+        bool fetchNextBatchRow();
         typename collection<C>::value_type& current();
       };
 
@@ -418,18 +426,27 @@ namespace Wt {
     Session *session_;
     enum { QueryCollection, RelationCollection } type_;
 
+    // Results loaded in advance, see Session::preload()
+    struct Fetched {
+      std::vector<C> values;
+      unsigned long changeCount;
+      int useCount;
+    };
+
     // Structure for a relation query
     struct RelationData {
       const std::string *sql;
       MetaDboBase *dbo;
       Impl::SetInfo *setInfo;
       Activity *activity; // only for ManyToMany collections
+      Fetched *fetched;
     };
 
     struct QueryData {
       SqlStatement *statement, *countStatement;
       int size;
       int useCount;
+      Fetched *fetched;
     };
 
     union {
@@ -441,6 +458,7 @@ namespace Wt {
     std::vector<C> manualModeRemovals_;
 
     friend class DboAction;
+    friend class Session;
     friend class SessionAddAction;
     friend class LoadBaseAction;
     friend class SaveBaseAction;
@@ -450,11 +468,15 @@ namespace Wt {
 
     collection(Session *session, SqlStatement *selectStatement,
                SqlStatement *countStatement);
+    collection(Session *session, std::vector<C>&& values);
 
     void setRelationData(MetaDboBase *dbo, const std::string *sql,
                          Impl::SetInfo *info);
     Activity *activity() const { return data_.relation.activity; }
     void resetActivity();
+    void setFetched(std::vector<C>&& values, unsigned long changeCount);
+    const std::vector<C> *fetched() const;
+    void releaseFetched();
     void releaseQuery();
 
     SqlStatement *executeStatement() const;
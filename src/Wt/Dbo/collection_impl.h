@@ -143,11 +143,23 @@ shared_impl::shared_impl(const collection<C>& collection,
                          SqlStatement *statement)
   : collection_(collection),
     statement_(statement),
+    fetched_(statement ? nullptr : collection.fetched()),
+    posFetched_(0),
+    batchRow_(0),
+    batchEnded_(false),
     useCount_(0),
     queryEnded_(false),
     posPastQuery_(0),
     ended_(false)
 {
+  /*
+   * Results of which all values are numbers or strings are fetched in
+   * batches, when the backend converts these itself.
+   */
+  if (Impl::batch_result_traits<C>::supported
+      && statement_ && statement_->supportsFetchBatch())
+    batch_.reset(new SqlResultBatch());
+
   fetchNextRow();
 }
 
@@ -174,7 +186,15 @@ void collection<C>::iterator::shared_impl::fetchNextRow()
     return;
   }
 
-  if (!statement_ || !statement_->nextRow()) {
+  bool haveRow;
+  if (fetched_)
+    haveRow = posFetched_ < fetched_->size();
+  else if (batch_)
+    haveRow = fetchNextBatchRow();
+  else
+    haveRow = statement_ && statement_->nextRow();
+
+  if (!haveRow) {
     queryEnded_ = true;
     if (collection_.manualModeInsertions().size() == 0)
       ended_ = true;
@@ -182,6 +202,13 @@ void collection<C>::iterator::shared_impl::fetchNextRow()
       statement_->done();
       collection_.iterateDone();
     }
+  } else if (fetched_) {
+    current_ = (*fetched_)[posFetched_++];
+
+    Impl::Helper<C>::skipIfRemoved(*this);
+  } else if (batch_) {
+    int column = 0;
+    Impl::batch_result_traits<C>::load(*batch_, batchRow_, column, current_);
   } else {
     int column = 0;
     current_
@@ -191,6 +218,28 @@ void collection<C>::iterator::shared_impl::fetchNextRow()
   }
 }
 
+template <class C>
+bool collection<C>::iterator::shared_impl::fetchNextBatchRow()
+{
+  static const int BatchSize = 1000;
+
+  if (++batchRow_ < batch_->rowCount())
+    return true;
+
+  if (batchEnded_)
+    return false;
+
+  /*
+   * A batch with fewer rows than asked for is the last one: the
+   * statement may not be asked for more rows after that.
+   */
+  int rows = statement_->fetchBatch(*batch_, BatchSize);
+  batchRow_ = 0;
+  batchEnded_ = rows < BatchSize;
+
+  return rows > 0;
+}
+
 template <class C>
 typename collection<C>::value_type& collection<C>::iterator::shared_impl::current()
 {
@@ -304,6 +353,7 @@ collection<C>::collection()
   data_.relation.dbo = nullptr;
   data_.relation.setInfo = nullptr;
   data_.relation.activity = nullptr;
+  data_.relation.fetched = nullptr;
 }
 
 template <class C>
@@ -317,6 +367,23 @@ collection<C>::collection(Session *session, SqlStatement *statement,
   data_.query->statement = statement;
   data_.query->countStatement = countStatement;
   data_.query->size = -1;
+  data_.query->fetched = nullptr;
+}
+
+template <class C>
+collection<C>::collection(Session *session, std::vector<C>&& values)
+  : session_(session),
+    type_(QueryCollection)
+{
+  data_.query = new QueryData();
+  data_.query->useCount = 1;
+  data_.query->statement = nullptr;
+  data_.query->countStatement = nullptr;
+  data_.query->size = static_cast<int>(values.size());
+  data_.query->fetched = new Fetched();
+  data_.query->fetched->values = std::move(values);
+  data_.query->fetched->changeCount = 0;
+  data_.query->fetched->useCount = 1;
 }
 
 template <class C>
@@ -325,9 +392,11 @@ collection<C>::collection(const collection<C>& other)
     type_(other.type_),
     data_(other.data_)
 {
-  if (type_ == RelationCollection)
+  if (type_ == RelationCollection) {
     data_.relation.activity = nullptr;
-  else
+    if (data_.relation.fetched)
+      ++data_.relation.fetched->useCount;
+  } else
     ++data_.query->useCount;
 }
 
@@ -345,6 +414,7 @@ collection<C>::collection(collection<C>&& other) noexcept
   other.data_.relation.dbo = nullptr;
   other.data_.relation.setInfo = nullptr;
   other.data_.relation.activity = nullptr;
+  other.data_.relation.fetched = nullptr;
 }
 
 template <class C>
@@ -356,6 +426,7 @@ void collection<C>::releaseQuery()
         data_.query->statement->done();
       if (data_.query->countStatement)
         data_.query->countStatement->done();
+      delete data_.query->fetched;
       delete data_.query;
     }
   }
@@ -365,18 +436,21 @@ template <class C>
 collection<C>& collection<C>::operator=(const collection<C>& other)
 {
   if (this != &other) {
-    if (type_ == RelationCollection)
+    if (type_ == RelationCollection) {
       delete data_.relation.activity;
-    else
+      releaseFetched();
+    } else
       releaseQuery();
 
     session_ = other.session_;
     type_ = other.type_;
     data_ = other.data_;
 
-    if (type_ == RelationCollection)
+    if (type_ == RelationCollection) {
       data_.relation.activity = nullptr;
-    else
+      if (data_.relation.fetched)
+        ++data_.relation.fetched->useCount;
+    } else
       ++data_.query->useCount;
   }
 
@@ -387,9 +461,10 @@ template <class C>
 collection<C>& collection<C>::operator=(collection<C>&& other) noexcept
 {
   if (this != &other) {
-    if (type_ == RelationCollection)
+    if (type_ == RelationCollection) {
       delete data_.relation.activity;
-    else
+      releaseFetched();
+    } else
       releaseQuery();
 
     session_ = other.session_;
@@ -404,6 +479,7 @@ collection<C>& collection<C>::operator=(collection<C>&& other) noexcept
     other.data_.relation.dbo = nullptr;
     other.data_.relation.setInfo = nullptr;
     other.data_.relation.activity = nullptr;
+    other.data_.relation.fetched = nullptr;
   }
 
   return *this;
@@ -412,9 +488,10 @@ collection<C>& collection<C>::operator=(collection<C>&& other) noexcept
 template <class C>
 collection<C>::~collection()
 {
-  if (type_ == RelationCollection)
+  if (type_ == RelationCollection) {
     delete data_.relation.activity;
-  else
+    releaseFetched();
+  } else
     releaseQuery();
 }
 
@@ -433,6 +510,9 @@ SqlStatement *collection<C>::executeStatement() const
   if (session_ && session_->flushMode() == FlushMode::Auto)
     session_->flush();
 
+  if (fetched())
+    return nullptr;
+
   if (type_ == QueryCollection)
     statement = data_.query->statement;
   else {
@@ -498,7 +578,12 @@ typename collection<C>::size_type collection<C>::size() const
 
   if (type_ == QueryCollection)
     countStatement = data_.query->countStatement;
-  else {
+  else if (const std::vector<C> *values = fetched()) {
+    std::size_t result = values->size() + manualModeInsertions_.size()
+      - manualModeRemovals_.size();
+
+    return static_cast<typename collection<C>::size_type>(result);
+  } else {
     if (data_.relation.sql) {
       const std::string *sql = data_.relation.sql;
       std::size_t f = Impl::ifind(*sql, " from ");
@@ -714,6 +799,49 @@ void collection<C>::resetActivity()
   relation.activity = nullptr;
 }
 
+template <class C>
+void collection<C>::setFetched(std::vector<C>&& values,
+                               unsigned long changeCount)
+{
+  releaseFetched();
+
+  Fetched *fetched = new Fetched();
+  fetched->values = std::move(values);
+  fetched->changeCount = changeCount;
+  fetched->useCount = 1;
+
+  data_.relation.fetched = fetched;
+}
+
+template <class C>
+const std::vector<C> *collection<C>::fetched() const
+{
+  /*
+   * The contents of a relation that were loaded in advance are used
+   * only as long as the session did not change the database since.
+   */
+  if (type_ == QueryCollection) {
+    if (data_.query->fetched)
+      return &data_.query->fetched->values;
+  } else {
+    const Fetched *fetched = data_.relation.fetched;
+    if (fetched && session_ && fetched->changeCount == session_->changeCount_)
+      return &fetched->values;
+  }
+
+  return nullptr;
+}
+
+template <class C>
+void collection<C>::releaseFetched()
+{
+  Fetched *fetched = data_.relation.fetched;
+  if (fetched && --fetched->useCount == 0)
+    delete fetched;
+
+  data_.relation.fetched = nullptr;
+}
+
 template <class C>
 void collection<C>::setRelationData(MetaDboBase *dbo,
                                     const std::string *sql,
@@ -182,6 +182,12 @@ struct dbo_default_traits
    * <tt>"version"</tt> field.
    */
   static const char *versionField() { return "version"; }
+
+  /*! \brief Configures use of the shared cache.
+   *
+   * By default, objects are not kept in a SharedCache.
+   */
+  static bool sharedCache() { return false; }
 };
 
 /*! \class dbo_traits Wt/Dbo/Dbo Wt/Dbo/Dbo
@@ -335,6 +341,17 @@ struct dbo_traits : public dbo_default_traits
    * together for your class by returning \c nullptr instead.
    */
   static const char *versionField();
+
+  /*! \brief Configures use of the shared cache.
+   *
+   * Returns whether objects of this class are kept in the SharedCache
+   * of a session (see Session::setSharedCache()), and loaded from it
+   * when loaded by id.
+   *
+   * This is intended for objects that are read often by many sessions
+   * and rarely changed.
+   */
+  static bool sharedCache();
 #endif // DOXYGEN_ONLY
 };
 
@@ -149,6 +149,9 @@ void MetaDbo<C>::doTransactionDone(bool success)
   Session *s = session();
 
   if (success) {
+    if (deletedInTransaction() || savedInTransaction())
+      s->invalidateShared(*this);
+
     if (deletedInTransaction()) {
       prune();
       setSession(nullptr);
@@ -37,6 +37,18 @@ namespace Impl {
         = query_result_traits<EIType>::load(session, statement, column);
     }
 
+    static const bool batchSupported = helper<I-1, Ts...>::batchSupported
+      && batch_result_traits<EIType>::supported;
+
+    static void load(const SqlResultBatch& batch, int row, int& column,
+                     TupleType& result)
+    {
+      helper<I-1, Ts...>::load(batch, row, column, result);
+
+      batch_result_traits<EIType>::load(batch, row, column,
+                                        std::get<I>(result));
+    }
+
     static void getValues(const TupleType& result, std::vector<cpp17::any>& values)
     {
       helper<I-1, Ts...>::getValues(result, values);
@@ -86,6 +98,11 @@ namespace Impl {
     static void load(WT_MAYBE_UNUSED Session& session, WT_MAYBE_UNUSED SqlStatement& statement, WT_MAYBE_UNUSED int& column, WT_MAYBE_UNUSED TupleType& type)
     { }
 
+    static const bool batchSupported = true;
+
+    static void load(WT_MAYBE_UNUSED const SqlResultBatch& batch, WT_MAYBE_UNUSED int row, WT_MAYBE_UNUSED int& column, WT_MAYBE_UNUSED TupleType& type)
+    { }
+
     static void getValues(WT_MAYBE_UNUSED const TupleType& type, WT_MAYBE_UNUSED std::vector<cpp17::any>& values)
     { }
 
@@ -102,6 +119,20 @@ namespace Impl {
     { }
   };
 
+  template <typename... T>
+  struct batch_result_traits<std::tuple<T...>>
+  {
+    typedef helper<sizeof...(T) - 1, T...> tuple_helper;
+
+    static const bool supported = tuple_helper::batchSupported;
+
+    static void load(const SqlResultBatch& batch, int row, int& column,
+                     std::tuple<T...>& result)
+    {
+      tuple_helper::load(batch, row, column, result);
+    }
+  };
+
 }
 
 template <typename... T>
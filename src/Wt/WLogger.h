@@ -17,6 +17,7 @@
 #include <Wt/Dbo/StringStream.h>
 #endif // WT_DBO_LOGGER
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -278,11 +279,60 @@ public:
    */
   bool useLock() const { return useLock_; }
 
+  /*! \brief Enumeration for what happens when an asynchronous log is full.
+   *
+   * \sa setAsync()
+   */
+  enum class OverflowPolicy {
+    Block, //!< Wait until the writer thread has made room for the line
+    Drop,  //!< Drop the line
+    Count  //!< Drop the line, and log the number of lines that were dropped
+  };
+
+  /*! \brief Configures asynchronous logging.
+   *
+   * When enabled, a line is not written by the thread that logs it,
+   * but queued in a lock-free ring buffer that holds \p capacity
+   * lines. A dedicated thread writes the queued lines in batches: to a
+   * file that was set using setFile(), each batch is written using a
+   * single system call (writev()), where supported.
+   *
+   * The \p policy determines what happens with a line when the buffer
+   * is full. Dropped lines are counted, see droppedLines().
+   *
+   * Disabling asynchronous logging first writes all queued lines. By
+   * default, logging is synchronous.
+   *
+   * \note This requires a multi-threaded build, and should not be
+   *       changed while other threads may be logging.
+   */
+  void setAsync(bool enable, std::size_t capacity = 8192,
+                OverflowPolicy policy = OverflowPolicy::Block);
+
+  /*! \brief Returns whether logging is asynchronous.
+   *
+   * \sa setAsync()
+   */
+  bool isAsync() const { return async_ != nullptr; }
+
+  /*! \brief Returns the number of lines that were dropped.
+   *
+   * Returns the number of lines that were dropped because the buffer
+   * was full, since asynchronous logging was enabled.
+   *
+   * \sa setAsync()
+   */
+  std::uint64_t droppedLines() const;
+
 private:
+  class AsyncWriter;
+
   std::ostream* o_;
   bool ownStream_;
   bool useLock_;
+  std::string path_;
   mutable std::mutex addLineLock_;
+  std::unique_ptr<AsyncWriter> async_;
   std::vector<Field> fields_;
 
   struct Rule {
@@ -780,6 +780,33 @@ public:
    */
   bool encodeTemplateText() const { return encodeTemplateText_; }
 
+  /*! \brief Enables caching of the rendered HTML.
+   *
+   * The HTML of a template that is bound only to strings (and not to
+   * widgets) is determined by its template text, the bound strings and
+   * conditions, the names of the added functions, and the locale and
+   * theme of the application. When this is enabled, that HTML is kept
+   * in a cache that is shared by all sessions, and rendering the
+   * template again with the same values, in this or another session,
+   * reuses it. This is useful for static content such as headers and
+   * footers, which is otherwise rendered again for every session.
+   *
+   * The cache is not used while widgets are bound, or when internal
+   * path encoding is enabled. If you specialize the rendering (e.g.
+   * resolveString() or a function), the result must also depend only
+   * on these values: a function is identified by its name only.
+   * Message resources are assumed to be the same for all sessions.
+   *
+   * The default value is \c false.
+   */
+  void setCacheable(bool cacheable);
+
+  /*! \brief Returns whether caching of the rendered HTML is enabled.
+   *
+   * \sa setCacheable()
+   */
+  bool isCacheable() const { return cacheable_; }
+
   virtual void refresh() override;
 
   /*! \brief Renders the template into the given result stream.
@@ -872,10 +899,20 @@ private:
   std::string errorText_;
   WStringStream boundWidgetsJs_;
 
-  bool encodeInternalPaths_, encodeTemplateText_, changed_;
+  bool encodeInternalPaths_, encodeTemplateText_, changed_, cacheable_;
   TemplateWidgetIdMode widgetIdMode_;
 
+  std::string htmlCacheKey_;
+
   std::string encode(const std::string& text) const;
+  bool hasBoundWidgets() const;
+  const std::string& htmlCacheKey();
+
+  struct Program;
+  std::shared_ptr<const Program> program_;
+
+  static std::shared_ptr<const Program>
+    compileTemplateText(const std::string& text);
   static std::size_t parseArgs(const std::string& text,
                                std::size_t pos,
                                std::vector<WString>& result);
@@ -8,12 +8,53 @@
 #ifndef HTTP_BUFFER_HPP
 #define HTTP_BUFFER_HPP
 
-#include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace http {
 namespace server {
 
-typedef std::array<char, 8192> Buffer;
+/*
+ * A receive buffer, of a size that is configured with
+ * --request-buffer-size.
+ *
+ * Its memory is drawn from a per-thread pool of free buffers, and
+ * returned to the pool of the thread that destroys it.
+ */
+class Buffer
+{
+public:
+  explicit Buffer(std::size_t size);
+  Buffer(Buffer&& other);
+  ~Buffer();
+
+  Buffer(const Buffer&) = delete;
+  Buffer& operator=(const Buffer&) = delete;
+  Buffer& operator=(Buffer&& other);
+
+  char *data() { return data_; }
+  const char *data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+private:
+  char *data_;
+  std::size_t size_;
+};
+
+class BufferPool
+{
+public:
+  struct Stats {
+    std::uint64_t hits;    // buffers reused from a pool
+    std::uint64_t misses;  // buffers that had to be allocated
+    std::uint64_t inUse;   // buffers currently held by connections
+  };
+
+  static char *acquire(std::size_t size);
+  static void release(char *data, std::size_t size);
+
+  static Stats stats();
+};
 
 }
 }
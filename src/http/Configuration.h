@@ -56,14 +56,25 @@ public:
   const std::string& pidPath() const { return pidPath_; }
   const std::string& serverName() const { return serverName_; }
   bool compression() const { return compression_; }
+  int gzipCompressionLevel() const { return gzipCompressionLevel_; }
+  int brotliCompressionQuality() const { return brotliCompressionQuality_; }
+  int zstdCompressionLevel() const { return zstdCompressionLevel_; }
+  bool sendFile() const { return sendFile_; }
+  bool http2() const { return http2_; }
   bool gdb() const { return gdb_; }
   const std::string& configPath() const { return configPath_; }
   const std::string& fileExtMapPath() const { return fileExtMapPath_; }
   const std::string& staticCacheControl() const { return staticCacheControl_; }
+  ::int64_t staticFileCacheSize() const { return staticFileCacheSize_; }
+  ::int64_t staticFileCacheMaxFileSize() const
+    { return staticFileCacheMaxFileSize_; }
+  int staticFileCacheCheckInterval() const
+    { return staticFileCacheCheckInterval_; }
 
   const std::vector<std::string>& httpListen() const { return httpListen_; }
   const std::string& httpAddress() const { return httpAddress_; }
   const std::string& httpPort() const { return httpPort_; }
+  int httpAcceptThreads() const { return httpAcceptThreads_; }
 
   const std::vector<std::string>& httpsListen() const { return httpsListen_; }
   const std::string& httpsAddress() const { return httpsAddress_; }
@@ -82,10 +93,13 @@ public:
 
   const std::string& sessionIdPrefix() const { return sessionIdPrefix_; }
   const std::string& accessLog() const { return accessLog_; }
+  int accessLogQueue() const { return accessLogQueue_; }
+  const std::string& accessLogOverflow() const { return accessLogOverflow_; }
 
   int parentPort() const { return parentPort_; }
 
   ::int64_t maxMemoryRequestSize() const { return maxMemoryRequestSize_; }
+  int requestBufferSize() const { return requestBufferSize_; }
 
   typedef std::function<std::string (std::size_t max_length, int purpose)>
     SslPasswordCallback;
@@ -113,14 +127,23 @@ private:
   std::string pidPath_;
   std::string serverName_;
   bool compression_;
+  int gzipCompressionLevel_;
+  int brotliCompressionQuality_;
+  int zstdCompressionLevel_;
+  bool sendFile_;
+  bool http2_;
   bool gdb_;
   std::string configPath_;
   std::string fileExtMapPath_;
   std::string staticCacheControl_;
+  ::int64_t staticFileCacheSize_;
+  ::int64_t staticFileCacheMaxFileSize_;
+  int staticFileCacheCheckInterval_;
 
   std::vector<std::string> httpListen_;
   std::string httpAddress_;
   std::string httpPort_;
+  int httpAcceptThreads_;
 
   std::vector<std::string> httpsListen_;
   std::string httpsAddress_;
@@ -137,10 +160,13 @@ private:
 
   std::string sessionIdPrefix_;
   std::string accessLog_;
+  int accessLogQueue_;
+  std::string accessLogOverflow_;
 
   int parentPort_;
 
   ::int64_t maxMemoryRequestSize_;
+  int requestBufferSize_;
 
   SslPasswordCallback sslPasswordCallback_;
 
@@ -40,6 +40,7 @@ namespace server {
 namespace asio = Wt::AsioWrapper::asio;
 
 class ConnectionManager;
+class Http2Session;
 class Server;
 
 /// Represents a single connection from a client.
@@ -64,9 +65,18 @@ public:
   /// Like CGI's Url scheme: http or https
   virtual const char *urlScheme() = 0;
 
+  /// Whether a Reply::FileRange can be transmitted directly from the
+  /// file to the socket
+  virtual bool supportsFileTransmission() const { return false; }
+
+  /// Whether HTTP/2 was negotiated with ALPN during the TLS handshake
+  virtual bool alpnHttp2() { return false; }
+
   virtual ~Connection();
 
   Server *server() const { return server_; }
+  /// The io_service that runs this connection's handlers.
+  asio::io_service& service() { return io_service_; }
   Wt::AsioWrapper::strand& strand() { return strand_; }
 
   /// Marks the TCP socket as transferrable.
@@ -93,6 +103,7 @@ public:
   bool waitingResponse() const { return waitingResponse_; }
   void setHaveResponse() { haveResponse_ = true; }
   void setResponseDone() { responseDone_ = true; }
+  bool responseDone() const { return responseDone_; }
   void startWriteResponse(ReplyPtr reply);
 
   void handleReadBody(ReplyPtr reply);
@@ -107,6 +118,12 @@ public:
                              const std::function<void()>& callback);
 
 protected:
+  /// Construct a connection that shares the strand of another
+  /// connection, for the streams of an HTTP/2 connection.
+  Connection(asio::io_service& io_service,
+             const Wt::AsioWrapper::strand& strand, Server *server,
+             ConnectionManager& manager, RequestHandler& handler);
+
   /// Get the native handle of the socket
   asio::ip::tcp::socket::native_handle_type native();
 
@@ -116,8 +133,12 @@ protected:
   void handleWriteResponse(ReplyPtr reply);
   void handleReadRequest(const Wt::AsioWrapper::error_code& e,
                          std::size_t bytes_transferred);
+  /// Start reading a request, now that data is available.
+  void handleWaitRequest(const Wt::AsioWrapper::error_code& e);
   /// Process read buffer, reading request.
   void handleReadRequest0();
+  /// Process read buffer, for an HTTP/2 connection.
+  void handleReadHttp2();
   void handleReadBody0(ReplyPtr reply,
                        const Wt::AsioWrapper::error_code& e,
                        std::size_t bytes_transferred);
@@ -128,6 +149,7 @@ protected:
   /// The manager for this connection.
   ConnectionManager& ConnectionManager_;
 
+  asio::io_service& io_service_;
   Wt::AsioWrapper::strand strand_;
 
   void finishReply();
@@ -163,6 +185,19 @@ private:
    */
   virtual void startAsyncReadRequest(Buffer& buffer, int timeout) = 0;
 
+  /*
+   * Asynchronously waiting for the next request on an idle connection,
+   * which does not hold on to a receive buffer. Should call
+   * handleWaitRequest() once data is available. The default
+   * implementation reads into a new buffer right away.
+   */
+  virtual void startAsyncWaitRequest(int timeout);
+
+  /*
+   * Cancels an asynchronous read, while waiting for a disconnect.
+   */
+  virtual void cancelAsyncRead();
+
   /*
    * Asynchronoulsy reading a request body
    */
@@ -176,11 +211,26 @@ private:
                                        const std::vector<asio::const_buffer>& buffers,
                                        int timeout) = 0;
 
+  /*
+   * Asynchronoulsy writing a response, followed by a file range. Only
+   * called when supportsFileTransmission().
+   */
+  virtual void startAsyncWriteFile(ReplyPtr reply,
+                                   const std::vector<asio::const_buffer>& buffers,
+                                   const Reply::FileRange& range,
+                                   int timeout);
+
   /// Generic I/O error handling: closes the connection and cancels timers
   void handleError(const Wt::AsioWrapper::error_code& e);
 
   void sendStockReply(Reply::status_type code);
 
+  /// Whether the data that was read starts a HTTP/2 connection
+  bool isHttp2Start();
+
+  /// Adds a new buffer to the receive buffers.
+  Buffer& newReceiveBuffer();
+
   /// The handler used to process the incoming request.
   RequestHandler& request_handler_;
 
@@ -193,7 +243,7 @@ private:
   /// Timer for reading data.
   asio::steady_timer readTimer_, writeTimer_;
 
-  /// Current request buffer data
+  /// Current request buffer data, empty while idle
   std::list<Buffer> rcv_buffers_;
 
   /// Size of last buffer and iterator for next request in last buffer
@@ -226,6 +276,14 @@ private:
   bool responseDone_;
 
   std::function<void()> disconnectCallback_;
+
+  /// Whether the first data read should be checked for HTTP/2
+  bool detectHttp2_;
+
+  /// The HTTP/2 session, when this connection speaks HTTP/2
+  std::shared_ptr<Http2Session> http2_;
+
+  friend class Http2Session;
 };
 
 typedef std::shared_ptr<Connection> ConnectionPtr;
@@ -0,0 +1,93 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_CONTENT_ENCODER_HPP
+#define HTTP_CONTENT_ENCODER_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace http {
+namespace server {
+
+class Configuration;
+class Request;
+
+/*
+ * Compresses a response body on the fly, for one of the content codings
+ * that wthttp was built with (gzip with zlib, br with brotli and zstd
+ * with zstd).
+ */
+class ContentEncoder
+{
+public:
+  enum class Coding {
+    Zstd,
+    Brotli,
+    Gzip
+  };
+
+  virtual ~ContentEncoder();
+
+  /*
+   * Returns the Content-Encoding value for a coding.
+   */
+  static const char *name(Coding coding);
+
+  /*
+   * Returns the file name extension of a precompressed static file
+   * for a coding (e.g. ".gz").
+   */
+  static const char *extension(Coding coding);
+
+  /*
+   * Returns whether a coding is available for on-the-fly compression.
+   */
+  static bool available(Coding coding);
+
+  /*
+   * Returns the codings that the request accepts, by decreasing quality
+   * value in its Accept-Encoding header. Codings with an equal quality
+   * value keep the order of preferred.
+   */
+  static std::vector<Coding> accepted(const Request& request,
+                                      const std::vector<Coding>& preferred);
+
+  /*
+   * Picks the accepted coding that is available, in the order of
+   * accepted(). Returns false if none is.
+   */
+  static bool negotiate(const Request& request, Coding& result);
+
+  /*
+   * Creates an encoder for an available coding, configured with the
+   * compression level from the configuration.
+   */
+  static std::unique_ptr<ContentEncoder> create(Coding coding,
+                                                const Configuration& config);
+
+  Coding coding() const { return coding_; }
+
+  /*
+   * Compresses the given data, appending the output to result. When
+   * finish is true, this is the last data and the stream is terminated.
+   */
+  virtual void encode(const char *data, std::size_t size, bool finish,
+                      std::string& result) = 0;
+
+protected:
+  explicit ContentEncoder(Coding coding);
+
+private:
+  Coding coding_;
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_CONTENT_ENCODER_HPP
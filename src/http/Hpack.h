@@ -0,0 +1,94 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HPACK_HPP
+#define HTTP_HPACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace http {
+namespace server {
+
+typedef std::pair<std::string, std::string> HpackHeader;
+typedef std::vector<HpackHeader> HpackHeaderList;
+
+/*
+ * Decodes HTTP/2 header blocks (RFC 7541), including the dynamic table
+ * and Huffman coded strings.
+ *
+ * A connection has a single decoder, which must see all header blocks
+ * in the order in which they were received.
+ */
+class HpackDecoder
+{
+public:
+  /*
+   * The default (and maximum) size of the dynamic table, which is what
+   * Http2Session advertises.
+   */
+  static const std::size_t DEFAULT_TABLE_SIZE = 4096;
+
+  enum class Result {
+    Ok,
+    Error,             // a decoding error
+    HeaderListTooLarge // the header list exceeds maxHeaderListSize
+  };
+
+  /*
+   * The size of a header list is computed as for
+   * SETTINGS_MAX_HEADER_LIST_SIZE: the size of the names and values,
+   * plus 32 bytes for each header.
+   */
+  explicit HpackDecoder(std::size_t maxHeaderListSize);
+
+  /*
+   * Decodes a complete header block, appending the headers to result.
+   *
+   * Decoding stops at an error, or as soon as the headers decoded from
+   * the block exceed the maximum header list size. The decoder state is
+   * then lost, and the connection must be closed.
+   */
+  Result decode(const unsigned char *data, std::size_t size,
+                HpackHeaderList& result);
+
+private:
+  std::deque<HpackHeader> table_; // most recent entry first
+  std::size_t tableSize_, maxTableSize_, maxHeaderListSize_;
+
+  bool lookup(std::uint64_t index, HpackHeader& result) const;
+  void add(const HpackHeader& header);
+  void evict();
+};
+
+/*
+ * Encodes HTTP/2 header blocks (RFC 7541).
+ *
+ * Headers are encoded as literals without indexing (with an indexed
+ * name when the static table has it), so that the encoder does not need
+ * a dynamic table of its own.
+ */
+class HpackEncoder
+{
+public:
+  static void encodeStatus(int status, std::string& result);
+
+  /*
+   * Encodes a header; the name must be in lower case.
+   */
+  static void encodeHeader(const std::string& name, const std::string& value,
+                           std::string& result);
+};
+
+}
+}
+
+#endif // HTTP_HPACK_HPP
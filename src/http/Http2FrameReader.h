@@ -0,0 +1,77 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_FRAME_READER_HPP
+#define HTTP_HTTP2_FRAME_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace http {
+namespace server {
+
+/*
+ * Splits the data received on an HTTP/2 connection into frames
+ * (RFC 9113, 4.1), after checking the client connection preface.
+ *
+ * Data may be appended in pieces of any size: a frame is returned once
+ * it has been received completely.
+ */
+class Http2FrameReader
+{
+public:
+  static const std::size_t FRAME_HEADER_SIZE = 9;
+
+  struct Frame {
+    std::size_t length;
+    unsigned type;
+    unsigned flags;
+    std::uint32_t streamId;
+    const unsigned char *payload;
+  };
+
+  enum class Result {
+    Frame,         // a complete frame was read
+    NeedMore,      // more data is needed
+    BadPreface,    // the data does not start with the connection preface
+    FrameTooLarge  // a frame exceeds the maximum frame size
+  };
+
+  /*
+   * Frames larger than maxFrameSize (SETTINGS_MAX_FRAME_SIZE) are
+   * rejected.
+   */
+  explicit Http2FrameReader(std::size_t maxFrameSize);
+
+  /*
+   * Returns whether data is (a prefix of) the client connection preface.
+   */
+  static bool isPreface(const char *data, std::size_t size);
+
+  /*
+   * Appends received data. This invalidates the payload of frames that
+   * were read before.
+   */
+  void append(const char *begin, const char *end);
+
+  /*
+   * Reads the next frame from the data that was appended.
+   */
+  Result next(Frame& frame);
+
+private:
+  std::string in_;
+  std::size_t pos_;
+  std::size_t maxFrameSize_;
+  bool prefaceReceived_;
+};
+
+}
+}
+
+#endif // HTTP_HTTP2_FRAME_READER_HPP
@@ -0,0 +1,175 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_SESSION_HPP
+#define HTTP_HTTP2_SESSION_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <Wt/AsioWrapper/system_error.hpp>
+
+#include "Hpack.h"
+#include "Http2FrameReader.h"
+
+namespace http {
+namespace server {
+
+class Connection;
+class Http2Stream;
+
+/*
+ * The HTTP/2 framing layer (RFC 9113) of a connection.
+ *
+ * Every stream is handled by an Http2Stream, which is a Connection of
+ * its own, so that requests go through the same RequestParser,
+ * RequestHandler and Reply machinery as HTTP/1 requests: a stream reads
+ * a request that is synthesized from its HEADERS, and its (HTTP/1.1)
+ * response is translated back into HEADERS and DATA frames.
+ *
+ * The session and its streams run in the strand of the connection.
+ */
+class Http2Session
+{
+public:
+  enum ErrorCode {
+    NoError = 0x0,
+    ProtocolError = 0x1,
+    InternalError = 0x2,
+    FlowControlError = 0x3,
+    StreamClosed = 0x5,
+    FrameSizeError = 0x6,
+    RefusedStream = 0x7,
+    Cancel = 0x8,
+    CompressionError = 0x9,
+    EnhanceYourCalm = 0xb
+  };
+
+  explicit Http2Session(Connection *connection);
+  ~Http2Session();
+
+  Http2Session(const Http2Session&) = delete;
+  Http2Session& operator=(const Http2Session&) = delete;
+
+  /*
+   * Returns whether data is (a prefix of) the client connection preface.
+   */
+  static bool isPreface(const char *data, std::size_t size);
+
+  /*
+   * Sends the server connection preface.
+   */
+  void start();
+
+  /*
+   * Processes data read from the connection.
+   */
+  void consume(const char *begin, const char *end);
+
+  /*
+   * Called when writing to the connection completed.
+   */
+  void writeDone(const Wt::AsioWrapper::error_code& e);
+
+  /*
+   * Whether the session is closing, after a connection error: no more
+   * data should be read.
+   */
+  bool closing() const { return closing_ || closed_; }
+
+  /*
+   * Whether there are no open streams.
+   */
+  bool idle() const { return streams_.empty(); }
+
+  /*
+   * Resets all streams, when the connection is closed.
+   */
+  void close();
+
+  /*
+   * Interface for Http2Stream
+   */
+  void sendHeaders(std::uint32_t streamId, const std::string& block);
+  void sendWindowUpdate(std::uint32_t streamId, std::size_t increment);
+  void closeStream(std::uint32_t streamId, bool complete);
+  void pump();
+  void flush();
+
+private:
+  enum FrameType {
+    DataFrame = 0x0,
+    HeadersFrame = 0x1,
+    PriorityFrame = 0x2,
+    RstStreamFrame = 0x3,
+    SettingsFrame = 0x4,
+    PushPromiseFrame = 0x5,
+    PingFrame = 0x6,
+    GoAwayFrame = 0x7,
+    WindowUpdateFrame = 0x8,
+    ContinuationFrame = 0x9
+  };
+
+  typedef std::map<std::uint32_t, std::shared_ptr<Http2Stream> > StreamMap;
+
+  Connection *connection_;
+  HpackDecoder decoder_;
+  StreamMap streams_;
+  std::uint32_t lastStreamId_;
+
+  Http2FrameReader reader_;
+
+  /* Streams reset by the client in the current interval */
+  unsigned resetCount_;
+  std::chrono::steady_clock::time_point resetIntervalStart_;
+
+  /* A header block that continues in CONTINUATION frames */
+  std::uint32_t headersStreamId_;
+  bool headersEndStream_;
+  std::string headerBlock_;
+
+  /* The initial stream send window, and the connection send window */
+  std::int64_t initialWindowSize_;
+  std::int64_t sendWindow_;
+
+  std::string out_, writing_;
+  bool writePending_;
+  bool closing_, closed_;
+
+  void handleFrame(unsigned type, unsigned flags, std::uint32_t streamId,
+                   const unsigned char *payload, std::size_t length);
+  void handleHeaders(unsigned flags, std::uint32_t streamId,
+                     const unsigned char *payload, std::size_t length);
+  void handleContinuation(unsigned flags, std::uint32_t streamId,
+                          const unsigned char *payload, std::size_t length);
+  void handleHeaderBlock(std::uint32_t streamId, bool endStream);
+  void handleData(unsigned flags, std::uint32_t streamId,
+                  const unsigned char *payload, std::size_t length);
+  void handleSettings(unsigned flags, std::uint32_t streamId,
+                      const unsigned char *payload, std::size_t length);
+  void handleWindowUpdate(std::uint32_t streamId,
+                          const unsigned char *payload, std::size_t length);
+
+  bool createRequest(const HpackHeaderList& headers, bool endStream,
+                     std::string& result, bool& bufferBody);
+  std::shared_ptr<Http2Stream> stream(std::uint32_t streamId);
+  void countReset();
+
+  void writeFrame(unsigned type, unsigned flags, std::uint32_t streamId,
+                  const char *data, std::size_t size);
+  void writeRstStream(std::uint32_t streamId, ErrorCode error);
+  void resetStream(std::uint32_t streamId, ErrorCode error);
+  void goAway(ErrorCode error);
+};
+
+}
+}
+
+#endif // HTTP_HTTP2_SESSION_HPP
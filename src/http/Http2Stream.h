@@ -0,0 +1,122 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_HTTP2_STREAM_HPP
+#define HTTP_HTTP2_STREAM_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "Connection.h"
+#include "Http2Session.h"
+
+namespace http {
+namespace server {
+
+/*
+ * A stream of an HTTP/2 connection, which handles a single request.
+ *
+ * It reads the request (in HTTP/1.1 syntax) from the data that is passed
+ * to it by the session, and passes its response on to the session, which
+ * transmits it in HEADERS and DATA frames. The stream is closed when the
+ * connection is stopped.
+ */
+class Http2Stream final : public Connection
+{
+public:
+  /*
+   * Creates a stream for a request. When bufferBody is true, the
+   * request does not specify its content length: the body is collected
+   * until the end of the stream, and the length is then added to the
+   * request.
+   */
+  Http2Stream(ConnectionPtr parent, Http2Session *session,
+              std::uint32_t id, const std::string& request,
+              bool bufferBody, bool endStream,
+              std::int64_t sendWindow, Server *server,
+              ConnectionManager& manager, RequestHandler& handler);
+
+  virtual asio::ip::tcp::socket& socket() override;
+  virtual const char *urlScheme() override;
+
+  std::uint32_t id() const { return id_; }
+
+  /*
+   * Interface for Http2Session
+   */
+  Http2Session::ErrorCode receiveData(const char *data, std::size_t size,
+                                      std::size_t padding, bool endStream);
+  bool endStream() const { return endStream_; }
+  void reset();
+
+  bool hasOutput() const { return sendPos_ < sendBuf_.size(); }
+  std::int64_t sendWindow() const { return sendWindow_; }
+  bool adjustSendWindow(std::int64_t delta);
+  std::size_t takeOutput(std::size_t max, std::string& result);
+  void completeWrite();
+
+protected:
+  virtual void startAsyncReadRequest(Buffer& buffer, int timeout) override;
+  virtual void startAsyncReadBody(ReplyPtr reply, Buffer& buffer,
+                                  int timeout) override;
+  virtual void cancelAsyncRead() override;
+  virtual void startAsyncWriteResponse
+      (ReplyPtr reply, const std::vector<asio::const_buffer>& buffers,
+       int timeout) override;
+
+  virtual void stop() override;
+
+  virtual void doSocketTransferCallback() override;
+
+private:
+  enum ReadState {
+    NotReading,
+    ReadingRequest,
+    ReadingBody
+  };
+
+  ConnectionPtr parent_;
+  Http2Session *session_;
+  std::uint32_t id_;
+
+  /* Request data that was received but not yet read */
+  std::string input_;
+  std::size_t headSize_;
+  std::size_t inputPos_;
+  /* Data before this position was credited to the peer when received */
+  std::size_t creditedPos_;
+  bool bufferBody_;
+  bool endStream_;
+  std::int64_t receiveWindow_;
+
+  ReadState readState_;
+  Buffer *readBuffer_;
+  ReplyPtr readReply_;
+
+  /* Response data that was not yet taken by the session */
+  std::string head_;
+  std::string sendBuf_;
+  std::size_t sendPos_;
+  std::int64_t sendWindow_;
+  bool headersSent_;
+
+  bool writePending_;
+  ReplyPtr writeReply_;
+  std::size_t writeSize_;
+
+  bool reset_;
+  bool stopped_;
+
+  void read();
+  void readDone(const Wt::AsioWrapper::error_code& e, std::size_t size);
+  bool sendResponseHead();
+};
+
+}
+}
+
+#endif // HTTP_HTTP2_STREAM_HPP
@@ -24,15 +24,12 @@
 
 #include <Wt/AsioWrapper/asio.hpp>
 
-#ifdef WTHTTP_WITH_ZLIB
-#include <zlib.h>
-#endif
-
 #include "Wt/WStringStream.h"
 #include "../web/Configuration.h"
 
 #include "AccessLogger.h"
 #include "Buffer.h"
+#include "ContentEncoder.h"
 #include "WHttpDllDefs.h"
 #include "Request.h"
 
@@ -155,6 +152,23 @@ public:
   void receive();
   void send();
 
+  /*
+   * A range of an open file, that is to be transmitted after the
+   * buffers returned by nextBuffers(), directly from the file to the
+   * socket (see Connection::supportsFileTransmission()).
+   */
+  struct FileRange {
+    int fd;
+    ::int64_t offset;
+    ::int64_t length;
+  };
+
+  /*
+   * Returns whether the last call to nextBuffers() resulted in a file
+   * range to be transmitted.
+   */
+  bool nextFileRange(FileRange& result);
+
   const Configuration& configuration() { return configuration_; }
 
   virtual void logReply(AccessLogger& logger);
@@ -182,6 +196,20 @@ protected:
 
   ConnectionPtr connection() const { return connection_; }
   bool transmitting() const { return transmitting_; }
+
+  /*
+   * Returns whether the content may be provided using setFileRange()
+   * instead of buffers: the connection must support it, and the content
+   * must be sent as is (not chunked or compressed).
+   */
+  bool canTransmitFile() const;
+
+  /*
+   * To be called from nextContentBuffers(), to have the connection
+   * transmit the given file range. The file remains owned by the reply
+   * and must be kept open until writeDone().
+   */
+  void setFileRange(int fd, ::int64_t offset, ::int64_t length);
   asio::const_buffer buf(const std::string &s);
 
 private:
@@ -194,11 +222,15 @@ private:
   bool transmitting_;
   bool closeConnection_;
   bool chunkedEncoding_;
-  bool gzipEncoding_;
+  // when compressing the content on the fly
+  std::unique_ptr<ContentEncoder> encoder_;
 
   ::int64_t contentSent_;
   ::int64_t contentOriginalSize_;
 
+  bool haveFileRange_;
+  FileRange fileRange_;
+
   ReplyPtr relay_;
 
   Wt::WStringStream buf_;
@@ -211,11 +243,6 @@ private:
   bool encodeNextContentBuffer(std::vector<asio::const_buffer>& result,
                                int& originalSize, int& encodedSize);
   void addDefaultHeaders();
-#ifdef WTHTTP_WITH_ZLIB
-  void initGzip();
-  bool gzipBusy_;
-  z_stream gzipStrm_;
-#endif
 };
 
 typedef std::shared_ptr<Reply> ReplyPtr;
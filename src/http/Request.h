@@ -142,6 +142,8 @@ public:
 
   bool closeConnection() const;
   bool acceptGzipEncoding() const;
+  bool acceptEncoding(const char *coding) const;
+  double acceptEncodingQuality(const char *coding) const;
   void enableWebSocket();
   const Header *getHeader(const std::string& name) const;
   const Header *getHeader(const char *name) const;
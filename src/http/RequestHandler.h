@@ -23,6 +23,7 @@
 #include "SessionProcessManager.h"
 #include "WtReply.h"
 #include "AccessLogger.h"
+#include "StaticFileCache.h"
 #include "../web/Configuration.h"
 
 namespace http {
@@ -68,6 +69,8 @@ private:
   AccessLogger& logger_;
   /// The session manager for dedicated processes
   SessionProcessManager *sessionManager_;
+  /// The cache of small static files
+  StaticFileCache staticFileCache_;
 
   /// Perform URL-decoding on a string and separates in path and
   /// query. Returns false if the encoding was invalid.
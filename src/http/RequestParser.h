@@ -87,6 +87,10 @@ private:
   /// Check if a byte is a digit.
   static bool is_digit(int c);
 
+  /// Consume the ordinary bytes of a uri, header name or header value
+  /// in one go, returning the first byte that is left to consume().
+  char *consumeRun(char *begin, char *end);
+
   bool consumeChar(char *d);
   void consumeToString(buffer_string& result, int maxSize);
   void consumeComplete(char *d);
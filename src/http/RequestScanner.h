@@ -0,0 +1,48 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_REQUEST_SCANNER_HPP
+#define HTTP_REQUEST_SCANNER_HPP
+
+namespace http {
+namespace server {
+
+/*
+ * Scanning of runs of ordinary bytes in a request head, which lets
+ * the RequestParser skip over the bulk of a request uri or header in
+ * one go, rather than passing each byte through its state machine.
+ *
+ * Each function returns the first byte in [begin, end) that needs the
+ * attention of the state machine (a delimiter or an invalid byte), or
+ * end. Where available, SSE2 or AVX2 is used to test 16 or 32 bytes at
+ * a time.
+ */
+class RequestScanner
+{
+public:
+  /*
+   * Stops at a space or a control character.
+   */
+  static const char *scanUri(const char *begin, const char *end);
+
+  /*
+   * Stops at a control character (which includes the '\r' that ends the
+   * value).
+   */
+  static const char *scanHeaderValue(const char *begin, const char *end);
+
+  /*
+   * Stops at a byte that is not a token character (which includes the
+   * ':' that ends the name).
+   */
+  static const char *scanHeaderName(const char *begin, const char *end);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_REQUEST_SCANNER_HPP
@@ -33,6 +33,10 @@
 
 #include <memory>
 
+#ifdef WT_THREADED
+#include <thread>
+#endif // WT_THREADED
+
 namespace http {
 namespace server {
 
@@ -79,14 +83,37 @@ private:
   std::vector<asio::ip::address> resolveAddress(asio::ip::tcp::resolver &resolver,
                                                 const std::string &address);
 
+  /// A thread that runs an io_service of its own, to accept and handle
+  /// http connections (--http-accept-threads)
+  struct AcceptThread {
+    AcceptThread();
+
+    asio::io_service service;
+    asio::executor_work_guard<asio::io_service::executor_type> work;
+#ifdef WT_THREADED
+    std::thread thread;
+#endif // WT_THREADED
+  };
+
   struct TcpListener {
     TcpListener(asio::ip::tcp::acceptor &&acceptor,
-                TcpConnectionPtr new_connection);
+                TcpConnectionPtr new_connection,
+                AcceptThread *acceptThread);
 
     asio::ip::tcp::acceptor acceptor;
     TcpConnectionPtr new_connection;
+
+    /// The thread that accepts and handles connections, or nullptr
+    /// if this is done by the shared thread pool
+    AcceptThread *acceptThread;
   };
 
+  /// Start the accept threads, called from the constructor
+  void startAcceptThreads();
+
+  /// Stop the accept threads, called from the destructor
+  void stopAcceptThreads();
+
   /// Add new TCP listener, called from start()
   void addTcpListener(asio::ip::tcp::resolver &resolver,
                       const std::string &address,
@@ -97,9 +124,20 @@ private:
                       const std::string &address,
                       Wt::AsioWrapper::error_code &errc);
 
+  /// Add new TCP acceptor, called from addTcpEndpoint
+  void addTcpAcceptor(const asio::ip::tcp::endpoint &endpoint,
+                      AcceptThread *acceptThread,
+                      Wt::AsioWrapper::error_code &errc);
+
   /// Starts accepting http/https connections
   void startAccept();
 
+  /// Starts an asynchronous accept operation on a TCP listener
+  void asyncTcpAccept(const std::shared_ptr<TcpListener>& listener);
+
+  /// Closes the TCP acceptors, from the thread that runs them
+  void closeTcpAcceptors();
+
   /// Start to connect to a listening TCP socket of the parent
   /// Used for dedicated processes.
   void startConnect();
@@ -141,6 +179,10 @@ private:
   /// The strand for handleTcpAccept(), handleSslAccept() and handleStop()
   Wt::AsioWrapper::strand accept_strand_;
 
+  /// Threads with their own http listeners and connections; these are
+  /// destroyed after the listeners and connections
+  std::vector<std::unique_ptr<AcceptThread>> accept_threads_;
+
   /// Acceptors used to listen for incoming http connections.
   std::vector<std::shared_ptr<TcpListener>> tcp_listeners_;
 
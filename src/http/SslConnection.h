@@ -49,6 +49,7 @@ public:
 
   virtual void start() override;
   virtual const char *urlScheme() override { return "https"; }
+  virtual bool alpnHttp2() override;
 
 protected:
 
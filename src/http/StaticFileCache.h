@@ -0,0 +1,99 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_STATIC_FILE_CACHE_HPP
+#define HTTP_STATIC_FILE_CACHE_HPP
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace http {
+namespace server {
+
+/*
+ * A bounded LRU cache of the contents of small static files, together
+ * with the Last-Modified and ETag values that StaticReply computes for
+ * them.
+ *
+ * Compressed variants (e.g. file.js.gz) are cached as entries of their
+ * own, and so is the fact that a file does not exist: StaticReply
+ * probes for a compressed sibling of every file it serves. Likewise, the
+ * fact that a file cannot be cached (e.g. because it is too large) is
+ * kept, so that it is not opened by the cache for every request.
+ *
+ * An entry is revalidated against the file system at most once every
+ * check interval, and reloaded if its size or modification time
+ * changed. Within that interval, serving a cached file does not need
+ * any system call.
+ */
+class StaticFileCache
+{
+public:
+  struct Entry {
+    bool exists;
+    std::string content;
+    std::chrono::system_clock::time_point lastWriteTime;
+    std::string modifiedDate;
+    std::string etag;
+  };
+
+  /*
+   * maxSize is the total size of all cached files (0 disables the cache),
+   * maxFileSize the size of the largest file that is cached.
+   */
+  StaticFileCache(std::size_t maxSize, std::size_t maxFileSize,
+                  std::chrono::seconds checkInterval);
+
+  StaticFileCache(const StaticFileCache&) = delete;
+  StaticFileCache& operator=(const StaticFileCache&) = delete;
+
+  bool enabled() const { return maxSize_ > 0; }
+
+  /*
+   * Returns the entry for the file with the given path, which may
+   * indicate that the file does not exist.
+   *
+   * Returns nullptr if the file cannot be cached (e.g. because it is too
+   * large, or not a regular file): it should then be read from disk.
+   */
+  std::shared_ptr<const Entry> find(const std::string& path);
+
+  std::size_t size() const;
+
+private:
+  typedef std::list<std::string> LruList;
+
+  struct Item {
+    std::shared_ptr<const Entry> entry; // nullptr if not cacheable
+    std::chrono::steady_clock::time_point validated;
+    LruList::iterator lru;
+  };
+
+  std::size_t maxSize_, maxFileSize_;
+  std::chrono::seconds checkInterval_;
+
+  mutable std::mutex mutex_;
+
+  std::unordered_map<std::string, Item> items_;
+  LruList lru_; // most recently used first
+  std::size_t size_;
+
+  std::shared_ptr<const Entry> load(const std::string& path,
+                                    const std::shared_ptr<const Entry>& old);
+  void store(const std::string& path, const std::shared_ptr<const Entry>& entry,
+             std::chrono::steady_clock::time_point validated);
+  void remove(const std::string& path);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_STATIC_FILE_CACHE_HPP
@@ -21,7 +21,9 @@
 #include <vector>
 #include <fstream>
 
+#include "ContentEncoder.h"
 #include "Reply.h"
+#include "StaticFileCache.h"
 
 namespace http {
 namespace server {
@@ -34,7 +36,9 @@ class StaticReply final : public Reply
 public:
   StaticReply(Request& request,
               const Configuration& config,
-              const Wt::Configuration* wtConfig = nullptr);
+              const Wt::Configuration* wtConfig = nullptr,
+              StaticFileCache* fileCache = nullptr);
+  virtual ~StaticReply();
 
   virtual void reset(const std::shared_ptr<const Wt::EntryPoint>& ep) override;
   virtual void writeDone(bool success) override;
@@ -55,8 +59,19 @@ private:
   std::ifstream stream_;
   ::int64_t fileSize_;
 
+  StaticFileCache *fileCache_;
+  // when served from the fileCache_, instead of the stream_
+  std::shared_ptr<const StaticFileCache::Entry> cached_;
+
+  // file descriptor used when transmitting the file with setFileRange()
+  int fd_;
+
   char buf_[64 * 1024];
 
+  int openFile(std::string& path,
+               const std::vector<ContentEncoder::Coding>& codings);
+  bool fileOpen() const;
+  void closeFile();
   std::string computeModifiedDate() const;
   std::string computeETag() const;
   static std::string computeExpires();
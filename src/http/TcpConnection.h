@@ -42,12 +42,22 @@ public:
 
   virtual const char *urlScheme() override { return "http"; }
 
+  virtual bool supportsFileTransmission() const override;
+
 protected:
   virtual void startAsyncReadRequest(Buffer& buffer, int timeout) override;
+  virtual void startAsyncWaitRequest(int timeout) override;
   virtual void startAsyncReadBody(ReplyPtr reply, Buffer& buffer, int timeout) override;
   virtual void startAsyncWriteResponse
       (ReplyPtr reply, const std::vector<asio::const_buffer>& buffers,
        int timeout) override;
+  virtual void startAsyncWriteFile
+      (ReplyPtr reply, const std::vector<asio::const_buffer>& buffers,
+       const Reply::FileRange& range, int timeout) override;
+
+  void handleWriteFile(ReplyPtr reply, Reply::FileRange range, int timeout,
+                       const Wt::AsioWrapper::error_code& e,
+                       std::size_t bytes_transferred);
 
   virtual void stop() override;
 
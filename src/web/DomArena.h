@@ -0,0 +1,124 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2024 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef DOM_ARENA_H_
+#define DOM_ARENA_H_
+
+#include <cstddef>
+
+#include "Wt/WDllDefs.h"
+
+namespace Wt {
+
+/*
+ * A memory arena for the DomElement trees of a single render.
+ *
+ * While a DomArena::Scope exists on a thread, DomElement objects and
+ * the nodes of their maps and vectors (see DomAllocator) are allocated
+ * from an arena: memory is taken from large blocks by bumping a
+ * pointer, and freeing it does nothing. The blocks are released at
+ * once, when the scope has ended and everything that was allocated
+ * from the arena has been freed. The blocks are then kept for the
+ * next arena on the same thread.
+ *
+ * Outside of a scope, and for large allocations, the heap is used.
+ *
+ * This is an internal API, subject to change.
+ */
+class WT_API DomArena
+{
+public:
+  /*
+   * Allocates from an arena until it is destroyed. A nested scope
+   * uses the arena of the outer scope.
+   */
+  class WT_API Scope
+  {
+  public:
+    Scope();
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    DomArena *arena_;
+  };
+
+  /*
+   * Allocation counts of the current thread.
+   */
+  struct Statistics {
+    unsigned long arenaAllocations; // served from an arena
+    unsigned long heapAllocations;  // served from the heap
+    unsigned long blocks;           // arena blocks taken from the heap
+  };
+
+  static void *allocate(std::size_t size);
+  static void deallocate(void *p) noexcept;
+
+  static Statistics statistics();
+  static void resetStatistics();
+
+private:
+  struct Block;
+  struct ThreadState;
+
+  Block *blocks_;
+  char *pos_, *end_;
+  std::size_t live_;
+  bool closed_;
+
+  DomArena();
+  ~DomArena();
+
+  void *allocateInBlock(std::size_t size);
+  void release() noexcept;
+
+  static ThreadState& threadState();
+};
+
+/*
+ * A standard allocator that allocates from the DomArena of the current
+ * render.
+ */
+template <typename T>
+class DomAllocator
+{
+public:
+  typedef T value_type;
+
+  DomAllocator() noexcept { }
+
+  template <typename U>
+  DomAllocator(const DomAllocator<U>&) noexcept { }
+
+  T *allocate(std::size_t n)
+  {
+    return static_cast<T *>(DomArena::allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, std::size_t) noexcept
+  {
+    DomArena::deallocate(p);
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const DomAllocator<T>&, const DomAllocator<U>&)
+{
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const DomAllocator<T>&, const DomAllocator<U>&)
+{
+  return false;
+}
+
+}
+
+#endif // DOM_ARENA_H_
@@ -16,6 +16,7 @@
 #include <string>
 
 #include "Wt/WWebWidget.h"
+#include "DomArena.h"
 #include "EscapeOStream.h"
 
 namespace Wt {
@@ -95,6 +96,60 @@ enum class Property { InnerHTML, AddedInnerHTML,
                       /* Keep as last, e.g. for bitset sizing. Otherwise, unused. */
                       LastPlusOne };
 
+#ifndef WT_TARGET_JAVA
+/*! \brief A map for the properties of a DOM element.
+ *
+ * Most elements have only a few properties. They are kept in a vector
+ * sorted on property, which holds up to 8 properties inside the map
+ * itself, and uses an (arena allocated) vector beyond that. Lookup is
+ * a linear scan.
+ *
+ * Inserting or erasing a property invalidates iterators.
+ *
+ * This is an internal API, subject to change.
+ */
+class WT_API DomPropertyMap
+{
+public:
+  typedef std::pair<Property, std::string> value_type;
+  typedef value_type *iterator;
+  typedef const value_type *const_iterator;
+
+  DomPropertyMap();
+
+  DomPropertyMap(const DomPropertyMap&) = delete;
+  DomPropertyMap& operator=(const DomPropertyMap&) = delete;
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+  std::size_t size() const { return size_; }
+
+  iterator find(Property property);
+  const_iterator find(Property property) const;
+
+  std::string& operator[](Property property);
+
+  std::size_t erase(Property property);
+  iterator erase(iterator i);
+
+  void clear();
+
+private:
+  static const std::size_t InlineCapacity = 8;
+
+  value_type inline_[InlineCapacity];
+  std::vector<value_type, DomAllocator<value_type> > overflow_;
+  value_type *data_;
+  std::size_t size_;
+
+  std::size_t lowerBound(Property property) const;
+};
+#endif // WT_TARGET_JAVA
+
 /*! \class DomElement web/DomElement web/DomElement
  *  \brief Class to represent a client-side DOM element (proxy).
  *
@@ -116,7 +171,7 @@ public:
 
 #ifndef WT_TARGET_JAVA
   /*! \brief A map for property values */
-  typedef std::map<Wt::Property, std::string> PropertyMap;
+  typedef DomPropertyMap PropertyMap;
 #else
   typedef std::treemap<Wt::Property, std::string> PropertyMap;
 #endif
@@ -139,6 +194,21 @@ public:
    */
   ~DomElement();
 
+#ifndef WT_TARGET_JAVA
+  /*
+   * Elements are allocated from the DomArena of the current render.
+   */
+  static void *operator new(std::size_t size)
+  {
+    return DomArena::allocate(size);
+  }
+
+  static void operator delete(void *p) noexcept
+  {
+    DomArena::deallocate(p);
+  }
+#endif // WT_TARGET_JAVA
+
   /*! \brief set dom element custom tag name
    */
   void setDomElementTagName(const std::string& name);
@@ -550,9 +620,14 @@ private:
       : jsCode(j), signalName(sn) { }
   };
 
-  typedef std::map<std::string, std::string> AttributeMap;
-  typedef std::set<std::string> AttributeSet;
-  typedef std::map<const char *, EventHandler> EventHandlerMap;
+  typedef std::map<std::string, std::string, std::less<std::string>,
+                   DomAllocator<std::pair<const std::string, std::string> > >
+    AttributeMap;
+  typedef std::set<std::string, std::less<std::string>,
+                   DomAllocator<std::string> > AttributeSet;
+  typedef std::map<const char *, EventHandler, std::less<const char *>,
+                   DomAllocator<std::pair<const char * const, EventHandler> > >
+    EventHandlerMap;
 
   bool willRenderInnerHtmlJS(WApplication *app) const;
   bool canWriteInnerHTML(WApplication *app) const;
@@ -606,9 +681,9 @@ private:
     ChildInsertion(int p, DomElement *c) : pos(p), child(c) { }
   };
 
-  std::vector<ChildInsertion> childrenToAdd_;
-  std::vector<std::string> childrenToSave_;
-  std::vector<DomElement *> updatedChildren_;
+  std::vector<ChildInsertion, DomAllocator<ChildInsertion> > childrenToAdd_;
+  std::vector<std::string, DomAllocator<std::string> > childrenToSave_;
+  std::vector<DomElement *, DomAllocator<DomElement *> > updatedChildren_;
   EStream childrenHtml_;
   TimeoutList timeouts_;
   std::string elementTagName_;
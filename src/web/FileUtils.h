@@ -25,7 +25,7 @@ namespace Wt {
     extern WT_API std::chrono::system_clock::time_point lastWriteTime(const std::string &file);
 #endif
     extern WT_API bool exists(const std::string &file);
-    extern bool isDirectory(const std::string &file);
+    extern WT_API bool isDirectory(const std::string &file);
     extern void listFiles(const std::string &directory,
                           std::vector<std::string> &files);
     extern std::string leaf(const std::string &file);
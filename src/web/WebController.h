@@ -7,10 +7,13 @@
 #ifndef WT_WEB_CONTROLLER_H_
 #define WT_WEB_CONTROLLER_H_
 
+#include <array>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <set>
 #include <map>
+#include <queue>
 #include <atomic>
 
 #include <Wt/WDllDefs.h>
@@ -19,6 +22,7 @@
 
 #include "EntryPoint.h"
 #include "SocketNotifier.h"
+#include "TimeUtil.h"
 
 #if defined(WT_THREADED) && !defined(WT_TARGET_JAVA)
 #include <thread>
@@ -134,6 +138,14 @@ public:
 
   std::vector<std::string> sessions(bool onlyRendered = false);
   bool expireSessions();
+
+  // Called by a session when its expiry time changed
+  void sessionExpiryChanged(WebSession *session);
+
+  // Duration of the last expireSessions() sweep, including the
+  // expiring of the sessions that timed out
+  std::chrono::microseconds lastExpireSweepDuration() const;
+
   void start();
   void shutdown();
 
@@ -156,14 +168,17 @@ public:
 
 #ifdef WT_TEST_VISIBILITY
   Signal<std::string> addedSessionId_;
+
+  std::shared_ptr<WebSession> findSession(const std::string& sessionId);
 #endif // WT_TEST_VISIBILITY
 
 private:
   Configuration& conf_;
+  const bool singleSession_;
   std::string singleSessionId_;
   bool autoExpire_;
-  int plainHtmlSessions_, ajaxSessions_;
-  volatile int zombieSessions_;
+  std::atomic<int> plainHtmlSessions_, ajaxSessions_;
+  std::atomic<int> zombieSessions_;
   std::string redirectSecret_;
   std::atomic_bool running_;
 
@@ -173,11 +188,61 @@ private:
   std::set<std::string> uploadProgressUrls_;
 
   typedef std::map<std::string, std::shared_ptr<WebSession> > SessionMap;
-  SessionMap sessions_;
+
+  /*
+   * An entry in the expiry index of a shard. Entries are not removed
+   * when a session is touched: a session only adds a new entry when
+   * its expiry time moves earlier. An entry that is found to be too
+   * early when it is popped is rescheduled at the session's actual
+   * expiry time. Thus, the earliest entry of a session is never later
+   * than its expiry time.
+   *
+   * The entry keeps the id under which the session was registered,
+   * since the session id may change concurrently with a sweep.
+   */
+  struct ExpiryEntry {
+    Time time;
+    std::string sessionId;
+    std::weak_ptr<WebSession> session;
+  };
+
+  struct ExpiryEntryLater {
+    bool operator()(const ExpiryEntry& a, const ExpiryEntry& b) const {
+      return (a.time - b.time) > 0;
+    }
+  };
+
+  typedef std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>,
+                              ExpiryEntryLater> ExpiryQueue;
+
+  /*
+   * The sessions are partitioned over a fixed number of shards, on the
+   * hash of their session id. Each shard has its own mutex, so that
+   * requests for different sessions do not contend on a single lock.
+   *
+   * When more than one shard lock is needed (shutdown()), they are
+   * always taken in shard order.
+   */
+  struct SessionShard {
+#ifdef WT_THREADED
+    mutable std::recursive_mutex mutex;
+#endif // WT_THREADED
+    SessionMap sessions;
+    ExpiryQueue expiryQueue;
+  };
+
+  static const std::size_t SESSION_SHARD_COUNT = 64;
+  std::array<SessionShard, SESSION_SHARD_COUNT> sessionShards_;
+
+  std::atomic<std::int64_t> lastExpireSweepDuration_;
+
+  SessionShard& sessionShard(const std::string& sessionId);
+  // assumes that you did grab the shard's mutex
+  void scheduleExpiry(SessionShard& shard, const std::string& sessionId,
+                      const std::shared_ptr<WebSession>& session);
 
 #ifdef WT_THREADED
-  // mutex to protect access to the sessions map and plain/ajax session
-  // counts
+  // mutex to protect access to singleSessionId_
   mutable std::recursive_mutex mutex_;
 
   SocketNotifier socketNotifier_;
@@ -173,14 +173,23 @@ inline const K * keyForUniquePtrValue(const std::map<K, std::unique_ptr<V> >& m,
 ;
 #endif
 
-template<typename K, typename V>
-void eraseAndNext(std::map<K, V>& m, typename std::map<K, V>::iterator& i)
+template<typename K, typename V, typename C, typename A>
+void eraseAndNext(std::map<K, V, C, A>& m,
+                  typename std::map<K, V, C, A>::iterator& i)
 {
 #ifndef WT_TARGET_JAVA
   m.erase(i++);
 #endif // WT_TARGET_JAVA
 }
 
+template<typename M>
+void eraseAndNext(M& m, typename M::iterator& i)
+{
+#ifndef WT_TARGET_JAVA
+  i = m.erase(i);
+#endif // WT_TARGET_JAVA
+}
+
 template<typename T>
 inline void insert(std::vector<T>& result, const std::vector<T>& elements)
 {
@@ -235,8 +244,8 @@ inline unsigned upper_bound(const std::vector<T>& v, const T& item)
     std::upper_bound(v.begin(), v.end(), item) - v.begin());
 }
 
-template <typename K, typename V, typename T>
-inline V& access(std::map<K, V>& m, const T& key)
+template <typename K, typename V, typename C, typename A, typename T>
+inline V& access(std::map<K, V, C, A>& m, const T& key)
 {
   return m[key];
 }
@@ -0,0 +1,64 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2024 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef TEST_HTTP_BROWSER_HEADS_H_
+#define TEST_HTTP_BROWSER_HEADS_H_
+
+namespace {
+
+/*
+ * Request heads as sent by Chrome and Firefox, to test and benchmark
+ * request parsing.
+ */
+const char *browserHeads[] = {
+  "GET /app/?wtd=Qb5yYkGJ7yJpVfLX&request=resource&resource=o1z9 HTTP/1.1\r\n"
+  "Host: www.example.com\r\n"
+  "Connection: keep-alive\r\n"
+  "sec-ch-ua: \"Chromium\";v=\"124\", \"Google Chrome\";v=\"124\", "
+  "\"Not-A.Brand\";v=\"99\"\r\n"
+  "sec-ch-ua-mobile: ?0\r\n"
+  "sec-ch-ua-platform: \"Linux\"\r\n"
+  "Upgrade-Insecure-Requests: 1\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 "
+  "(KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,"
+  "image/avif,image/webp,image/apng,*/*;q=0.8,"
+  "application/signed-exchange;v=b3;q=0.7\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Sec-Fetch-Mode: navigate\r\n"
+  "Sec-Fetch-User: ?1\r\n"
+  "Sec-Fetch-Dest: document\r\n"
+  "Referer: https://www.example.com/app/?wtd=Qb5yYkGJ7yJpVfLX\r\n"
+  "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+  "Accept-Language: en-US,en;q=0.9,nl;q=0.8\r\n"
+  "Cookie: Wt.Auth=5a1c0e9f83b14a0fa2c3c0b1d9f7e6a4; "
+  "_ga=GA1.2.1234567890.1700000000; _gid=GA1.2.987654321.1700000000; "
+  "theme=dark\r\n"
+  "\r\n",
+
+  "POST /app/?wtd=Qb5yYkGJ7yJpVfLX HTTP/1.1\r\n"
+  "Host: www.example.com\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:125.0) Gecko/20100101 "
+  "Firefox/125.0\r\n"
+  "Accept: */*\r\n"
+  "Accept-Language: en-US,en;q=0.5\r\n"
+  "Accept-Encoding: gzip, deflate, br, zstd\r\n"
+  "Content-type: application/x-www-form-urlencoded; charset=UTF-8\r\n"
+  "Content-Length: 312\r\n"
+  "Origin: https://www.example.com\r\n"
+  "Connection: keep-alive\r\n"
+  "Referer: https://www.example.com/app/\r\n"
+  "Cookie: Wt.Auth=5a1c0e9f83b14a0fa2c3c0b1d9f7e6a4; theme=dark\r\n"
+  "Sec-Fetch-Dest: empty\r\n"
+  "Sec-Fetch-Mode: cors\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Priority: u=4\r\n"
+  "\r\n"
+};
+
+}
+
+#endif // TEST_HTTP_BROWSER_HEADS_H_